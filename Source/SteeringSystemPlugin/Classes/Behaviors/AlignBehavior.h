@@ -66,4 +66,9 @@ public:
         static const FName Type(TEXT("AlignBehavior"));
         return Type;
     }
+
+    virtual SIZE_T GetAllocatedSize() const override
+    {
+        return sizeof(*this);
+    }
 };
@@ -71,6 +71,11 @@ public:
         static const FName Type(TEXT("ArriveBehavior"));
         return Type;
     }
+
+    virtual SIZE_T GetAllocatedSize() const override
+    {
+        return sizeof(*this);
+    }
 };
 
 //class FAdjustArrivalBehavior : public FSteeringBehavior
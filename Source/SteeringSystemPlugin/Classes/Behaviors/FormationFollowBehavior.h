@@ -28,6 +28,7 @@
 #pragma once
 
 #include "SteeringBehavior.h"
+#include "VSteeringMemory.h"
 
 #include "Behaviors/AlignBehavior.h"
 #include "Behaviors/ArriveBehavior.h"
@@ -115,4 +116,10 @@ public:
         static const FName Type(TEXT("FormationFollowBehavior"));
         return Type;
     }
+
+    virtual SIZE_T GetAllocatedSize() const override
+    {
+        // Finished flag is shared with the formation behavior that created this behavior
+        return sizeof(*this) + sizeof(bool) + FVSteeringMemory::SharedReferenceSize;
+    }
 };
@@ -94,9 +94,25 @@ public:
         bRequirePrimary = true;
     }
 
+    virtual bool GetMovementTarget(FVector& OutTargetLocation) const override
+    {
+        OutTargetLocation = SteeringTarget.GetLocation();
+        return ! bTargetReached;
+    }
+
+    virtual float GetAnchorSpeed() const override
+    {
+        return bTargetReached ? 0.f : CurrentAnchorSpeed;
+    }
+
     FORCEINLINE virtual FName GetType() const override
     {
         static const FName Type(TEXT("MoveFormationBehavior"));
         return Type;
     }
+
+    virtual SIZE_T GetAllocatedSize() const override
+    {
+        return sizeof(*this) + MemberSet.GetAllocatedSize() + FinishedBehaviors.GetAllocatedSize();
+    }
 };
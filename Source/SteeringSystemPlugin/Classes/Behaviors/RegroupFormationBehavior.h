@@ -58,4 +58,9 @@ public:
         static const FName Type(TEXT("RegroupFormationBehavior"));
         return Type;
     }
+
+    virtual SIZE_T GetAllocatedSize() const override
+    {
+        return sizeof(*this) + MemberSet.GetAllocatedSize() + FinishedBehaviors.GetAllocatedSize();
+    }
 };
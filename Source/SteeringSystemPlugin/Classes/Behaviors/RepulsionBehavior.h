@@ -51,6 +51,11 @@ public:
         static const FName Type(TEXT("RepulsionBehavior"));
         return Type;
     }
+
+    virtual SIZE_T GetAllocatedSize() const override
+    {
+        return sizeof(*this);
+    }
 };
 
 class FLineRepulsionBehavior : public FSteeringBehavior
@@ -79,4 +84,9 @@ public:
         static const FName Type(TEXT("LineRepulsionBehavior"));
         return Type;
     }
+
+    virtual SIZE_T GetAllocatedSize() const override
+    {
+        return sizeof(*this);
+    }
 };
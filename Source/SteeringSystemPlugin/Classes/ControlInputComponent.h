@@ -29,6 +29,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "VConcurrentInput.h"
 #include "ControlInputComponent.generated.h"
 
 /** 
@@ -95,6 +96,13 @@ public:
 	virtual bool IsAccelerationEnabled() const;
 
 	FORCEINLINE void AddInputVector_Direct(FVector WorldVector, bool bForce = false);
+
+	/**
+	 * Thread-safe version of AddInputVector_Direct(), may be called from worker threads evaluating steering.
+	 * Input is merged into the pending input vector by ConsumeInputVector_Direct(), independent of producer order.
+	 */
+	void AddInputVector_Concurrent(const FVector& WorldVector, bool bForce = false);
+
 	FORCEINLINE void SetEnableAcceleration_Direct(bool bInEnableAcceleration);
 	FORCEINLINE FVector GetPendingInputVector_Direct() const;
 	FORCEINLINE FVector GetLastInputVector_Direct() const;
@@ -118,6 +126,12 @@ protected:
 	UPROPERTY(Transient)
 	FVector LastControlInputVector;
 
+	/**
+	 * Control input accumulated from any thread, merged into ControlInputVector when consumed.
+	 * @see AddInputVector_Concurrent()
+	 */
+	FVConcurrentInputAccumulator ConcurrentControlInput;
+
 	/**
 	 * Whether move input is ignored.
 	 * @see IsMoveInputIgnored()
@@ -77,6 +77,18 @@ public:
         return OwningFormation && OwningFormation->HasValidData() && (!bRequirePrimary || OwningFormation->HasPrimary());
     }
 
+    // Returns formation movement target location, if the behavior has any
+    virtual bool GetMovementTarget(FVector& OutTargetLocation) const
+    {
+        return false;
+    }
+
+    // Returns current formation anchor movement speed
+    virtual float GetAnchorSpeed() const
+    {
+        return 0.f;
+    }
+
     bool CalculateSteering(float DeltaTime)
     {
         if (IsActive() && HasValidData())
@@ -31,6 +31,7 @@
 #include "GameFramework/Actor.h"
 #include "GameFramework/HUD.h"
 #include "UObject/ObjectMacros.h"
+#include "VSpatialGrid.h"
 #include "HUDExt.generated.h"
 
 UCLASS(notplaceable, transient, BlueprintType, Blueprintable)
@@ -40,13 +41,125 @@ class STEERINGSYSTEMPLUGIN_API AHUDExt : public AHUD
 
     /**
      * Finds the array of actors inside a selection rectangle from a list of its owned components.
+     * Component bounds are projected in batch with the canvas view projection matrix.
+     * If bUseBoundsSphere is set, only bounds centers are projected and tested with their screen space radius, which is cheaper but approximate.
      */
     UFUNCTION(Category=HUD)
-    void FindFilteredActorsInSelectionRectangle(const TArray<USceneComponent*>& Components, const FVector2D& FirstPoint, const FVector2D& SecondPoint, TArray<AActor*>& OutActors, bool bActorMustBeFullyEnclosed = false);
+    void FindFilteredActorsInSelectionRectangle(const TArray<USceneComponent*>& Components, const FVector2D& FirstPoint, const FVector2D& SecondPoint, TArray<AActor*>& OutActors, bool bActorMustBeFullyEnclosed = false, bool bUseBoundsSphere = false);
 
     /**
      * Finds the array of actors inside a selection rectangle from a list of its owned components.
      */
     UFUNCTION(Category=HUD)
-    TArray<AActor*> GetFilteredActorsInSelectionRectangle(const TArray<USceneComponent*>& Components, const FVector2D& FirstPoint, const FVector2D& SecondPoint, bool bActorMustBeFullyEnclosed = false);
+    TArray<AActor*> GetFilteredActorsInSelectionRectangle(const TArray<USceneComponent*>& Components, const FVector2D& FirstPoint, const FVector2D& SecondPoint, bool bActorMustBeFullyEnclosed = false, bool bUseBoundsSphere = false);
+
+public:
+
+    AHUDExt(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+    //BEGIN AActor Interface
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+    //END AActor Interface
+
+    /** Cell size of the selectable component spatial index. */
+    UPROPERTY(EditDefaultsOnly, Category=HUD, meta=(ClampMin="1", UIMin="1"))
+    float SelectionIndexCellSize;
+
+    /** Add component to the selectable component spatial index. Its index entry is updated when the component transform is updated. */
+    UFUNCTION(BlueprintCallable, Category=HUD)
+    void RegisterSelectable(USceneComponent* Component);
+
+    /** Remove component from the selectable component spatial index. */
+    UFUNCTION(BlueprintCallable, Category=HUD)
+    void UnregisterSelectable(USceneComponent* Component);
+
+    /**
+     * Finds the array of actors inside a selection rectangle from registered selectable components.
+     * Candidates are culled with the world space frustum of the selection rectangle against the selectable spatial index
+     * before performing screen space bounds tests.
+     */
+    UFUNCTION(BlueprintCallable, Category=HUD)
+    void FindSelectableActorsInSelectionRectangle(const FVector2D& FirstPoint, const FVector2D& SecondPoint, TArray<AActor*>& OutActors, bool bActorMustBeFullyEnclosed = false, bool bUseBoundsSphere = false);
+
+    // ~ Incremental Selection Session
+
+    /**
+     * Begin incremental drag selection of registered selectable components.
+     * Ends any active selection session.
+     */
+    UFUNCTION(BlueprintCallable, Category=HUD)
+    void BeginSelectionSession(const FVector2D& FirstPoint, bool bActorMustBeFullyEnclosed = false, bool bUseBoundsSphere = false);
+
+    /**
+     * Update selection session rectangle and output selection changes since the previous update.
+     * Only units within the strips between the previous and the current rectangle are tested,
+     * all units are tested again if the view changes. Requires a valid canvas, call from DrawHUD().
+     */
+    UFUNCTION(BlueprintCallable, Category=HUD)
+    void UpdateSelectionSession(const FVector2D& SecondPoint, TArray<AActor*>& OutAddedActors, TArray<AActor*>& OutRemovedActors);
+
+    /** End selection session and clear session selection */
+    UFUNCTION(BlueprintCallable, Category=HUD)
+    void EndSelectionSession();
+
+    UFUNCTION(BlueprintCallable, Category=HUD)
+    bool IsSelectionSessionActive() const;
+
+    /** Get actors currently selected by the selection session */
+    UFUNCTION(BlueprintCallable, Category=HUD)
+    void GetSelectionSessionActors(TArray<AActor*>& OutActors) const;
+
+private:
+
+    struct FSelectionSession
+    {
+        FSelectionSession()
+            : FirstPoint(ForceInitToZero)
+            , Rectangle(ForceInit)
+            , ViewProjection(ForceInitToZero)
+            , bActive(false)
+            , bActorMustBeFullyEnclosed(false)
+            , bUseBoundsSphere(false)
+        {
+        }
+
+        FVector2D FirstPoint;
+        FBox2D Rectangle;
+        FMatrix ViewProjection;
+        TSet<TWeakObjectPtr<USceneComponent>> Selected;
+        bool bActive;
+        bool bActorMustBeFullyEnclosed;
+        bool bUseBoundsSphere;
+    };
+
+    FSelectionSession SelectionSession;
+
+    struct FSelectable
+    {
+        TWeakObjectPtr<USceneComponent> Component;
+        FDelegateHandle TransformUpdatedHandle;
+    };
+
+    /** Registered selectables, sparse indices are stable and used as spatial index items */
+    TSparseArray<FSelectable> Selectables;
+    TMap<TWeakObjectPtr<USceneComponent>, int32> SelectableIndices;
+    TArray<USceneComponent*> SelectionCandidates;
+    TArray<int32> SelectionQueryItems;
+
+    /** Spatial index of selectable components, only selectables moved since the previous query are updated */
+    FVSpatialGrid SelectionIndex;
+    TSet<int32> DirtySelectables;
+
+    void RemoveSelectable(int32 Index);
+
+    void OnSelectableTransformUpdated(USceneComponent* Component, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+
+    /** Update spatial index entries of moved selectables */
+    void UpdateSelectionIndex();
+
+    /** Build world space frustum of the selection rectangle, returns false if the rectangle is degenerate */
+    bool GetSelectionFrustum(const FBox2D& SelectionRectangle, TArray<FPlane>& OutPlanes);
+
+    /** Gather registered selectable components within the selection rectangle frustum into SelectionCandidates */
+    void GatherSelectionCandidates(const FBox2D& SelectionRectangle);
 };
@@ -50,6 +50,7 @@ public:
 	virtual bool HasFormation() const = 0;
     // Steering Properties
 	virtual FTickFunction* GetSteerableTickFunction() = 0;
+	virtual UObject* GetSteerableObject() = 0;
 	virtual FString GetSteerableName() const = 0;
 	virtual FVector GetSteerableLocation() const = 0;
 	virtual FQuat GetSteerableOrientation() const = 0;
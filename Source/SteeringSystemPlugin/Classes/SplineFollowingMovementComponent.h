@@ -34,6 +34,8 @@
 #include "CoreMinimal.h"
 #include "UObject/ObjectMacros.h"
 #include "VSmoothDeltaMovementComponent.h"
+#include "VBakedSplineCache.h"
+#include "VSplineFollowerBatch.h"
 #include "SplineFollowingMovementComponent.generated.h"
 
 /** 
@@ -46,15 +48,104 @@ class STEERINGSYSTEMPLUGIN_API USplineFollowingMovementComponent : public UVSmoo
 
 public:
 
+    USplineFollowingMovementComponent(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+    /**
+     * If true, spline source transforms are sampled from a shared baked arc length table instead of evaluating the spline.
+     * Baked table is shared by all followers of the same spline source and rebuilt when the spline is modified.
+     * Baked sampling approximates the spline between samples, disabled by default.
+     */
+    UPROPERTY(Category="Spline Following", EditAnywhere, BlueprintReadWrite)
+    bool bUseBakedSpline;
+
+    /**
+     * If true, target transforms of all followers of the same spline source are evaluated together once per frame.
+     * Requires bUseBakedSpline. Must be set before movement source is assigned.
+     */
+    UPROPERTY(Category="Spline Following", EditAnywhere, BlueprintReadOnly, meta=(EditCondition="bUseBakedSpline"))
+    bool bUseBatchEvaluation;
+
+    /**
+     * If true, updated component is moved along the spline without sweeping and engine overlap updates are disabled.
+     * Contacts are instead detected by a coarse overlap query every KinematicOverlapInterval seconds,
+     * which fires hit events for blocking contacts and begin/end overlap events on both sides of overlapping contacts.
+     * Simulated proxies run the same queries but only fire overlap events, blocking contacts are handled by the server.
+     * Meant for followers on routes that are known to be clear.
+     */
+    UPROPERTY(Category="Spline Following|Kinematic", EditAnywhere, BlueprintReadWrite)
+    bool bKinematicMovement;
+
+    /** Time interval between kinematic overlap queries. Zero performs the query every movement update. */
+    UPROPERTY(Category="Spline Following|Kinematic", EditAnywhere, BlueprintReadWrite, meta=(ClampMin="0", UIMin="0", EditCondition="bKinematicMovement"))
+    float KinematicOverlapInterval;
+
+    /** Object types tested by kinematic overlap queries */
+    UPROPERTY(Category="Spline Following|Kinematic", EditAnywhere, BlueprintReadWrite, meta=(EditCondition="bKinematicMovement"))
+    TArray<TEnumAsByte<EObjectTypeQuery>> KinematicOverlapObjectTypes;
+
     /** Event called after owning actor movement source changes. */
     virtual void MovementSourceChange() override;
 
+    //Begin UActorComponent Interface
+    virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction) override;
+    virtual void OnUnregister() override;
+    //End UActorComponent Interface
+
 protected:
 
     /** Current movement source. */
     UPROPERTY()
     class USplineComponent* SplineSource;
 
+    /** Shared baked spline source, valid if bUseBakedSpline is true */
+    FPSBakedSpline BakedSpline;
+
+    /** Acquire baked spline source if missing or out of date */
+    void UpdateBakedSpline();
+
+    /** Batch evaluation group of the current spline source */
+    FPSSplineFollowerGroup BatchGroup;
+
+    /** Index within batch evaluation group, managed by the group */
+    int32 BatchIndex;
+
+    friend class FVSplineFollowerGroup;
+
+    /** Update batch evaluation group registration with the current spline source */
+    void UpdateBatchGroup();
+
+    /** Time accumulated since the last kinematic overlap query */
+    float KinematicOverlapTime;
+
+    /** Whether updated primitive overlap events were disabled by kinematic movement and require restoring */
+    bool bKinematicOverlapEventsDisabled;
+
+    /** Contacts found by the last kinematic overlap query */
+    TArray<TWeakObjectPtr<UPrimitiveComponent>> KinematicContacts;
+
+    /** Toggle kinematic contact tracking, restores engine overlap updates when disabled */
+    void SetKinematicCollisionEnabled(bool bEnabled);
+
+    /**
+     * Run kinematic overlap query if the query interval has elapsed and dispatch contact changes.
+     * Blocking contacts are only handled if bHandleImpact is true.
+     */
+    void UpdateKinematicContacts(float DeltaTime, bool bHandleImpact);
+
+    /** Clear tracked contacts, dispatching end overlap events */
+    void ClearKinematicContacts();
+
+    void OnKinematicContactBegin(UPrimitiveComponent* OtherComp, float DeltaTime, bool bHandleImpact);
+    void OnKinematicContactEnd(UPrimitiveComponent* OtherComp);
+
+    /** Returns the spline time this follower will move to in the current frame movement update */
+    float GetPredictedSplineTime() const;
+
+    // World space spline source queries at spline time, using constant velocity
+    FVector GetSourceLocationAtTime(float SplineTime) const;
+    FQuat GetSourceQuaternionAtTime(float SplineTime) const;
+    FTransform GetSourceTransformAtTime(float SplineTime) const;
+
     /** Actual server movement update implementation */
     virtual void MovementUpdate(float DeltaTime) override;
     virtual void MovementUpdateImpl(float DeltaTime, bool bHandleImpact);
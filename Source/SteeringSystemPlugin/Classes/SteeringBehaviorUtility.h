@@ -50,6 +50,25 @@ class STEERINGSYSTEMPLUGIN_API USteeringBehaviorUtility : public UBlueprintFunct
     UFUNCTION(BlueprintCallable)
     static FSteeringTarget MakeTargetRotation(const FRotator& InRotation);
 
+    UFUNCTION(BlueprintCallable)
+    static FSteeringTarget MakeTargetComponent(USceneComponent* InComponent);
+
+    /** Returns target location, tracked component location for component targets and zero for direction targets */
+    UFUNCTION(BlueprintPure)
+    static FVector GetTargetLocation(const FSteeringTarget& InSteeringTarget);
+
+    /** Returns target rotation, tracked component rotation for component targets and zero rotator for point targets */
+    UFUNCTION(BlueprintPure)
+    static FRotator GetTargetRotation(const FSteeringTarget& InSteeringTarget);
+
+    /** Returns tracked component of component targets, null otherwise */
+    UFUNCTION(BlueprintPure)
+    static USceneComponent* GetTargetComponent(const FSteeringTarget& InSteeringTarget);
+
+    /** Native break node of FSteeringTarget */
+    UFUNCTION(BlueprintPure, meta=(NativeBreakFunc))
+    static void BreakSteeringTarget(const FSteeringTarget& InSteeringTarget, FVector& Location, FRotator& Rotation, USceneComponent*& TargetComponent);
+
     UFUNCTION(BlueprintCallable)
     static FSteeringBehaviorRef CreateArriveBehavior(const FSteeringTarget& InSteeringTarget, float InOuterRadius = 150.f, float InInnerRadius = 50.f);
 
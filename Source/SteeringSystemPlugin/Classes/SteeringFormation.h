@@ -63,6 +63,12 @@ public:
         OwningFormation = InFormation;
     }
 
+    // Size of the utility object and its owned allocations, used for memory accounting
+    virtual SIZE_T GetAllocatedSize() const
+    {
+        return sizeof(FFormationUtilityInterface);
+    }
+
     FORCEINLINE bool HasOwningFormation() const
     {
         return OwningFormation != nullptr;
@@ -104,6 +110,12 @@ class FPrimaryAssignmentStrategy
 {
 public:
     virtual ISteerable* FindPrimary(const FSteeringFormation& Formation) = 0;
+
+    // Size of the strategy object and its owned allocations, used for memory accounting
+    virtual SIZE_T GetAllocatedSize() const
+    {
+        return sizeof(FPrimaryAssignmentStrategy);
+    }
 };
 
 // Default Utility Classes
@@ -126,18 +138,33 @@ public:
     virtual void UpdateFormationPattern() override;
     virtual void CalculateSlotLocation(int32 SlotIndex, FVector& OutLocation) override;
     virtual void CalculateSlotOrientation(int32 SlotIndex, FQuat& SlotOrientation) override;
+
+    virtual SIZE_T GetAllocatedSize() const override
+    {
+        return sizeof(*this) + SlotOffsets.GetAllocatedSize();
+    }
 };
 
 class FDefaultSlotAssignmentStrategy : public FSlotAssignmentStrategy
 {
 public:
     virtual void UpdateSlotAssignments() override;
+
+    virtual SIZE_T GetAllocatedSize() const override
+    {
+        return sizeof(*this);
+    }
 };
 
 class FDefaultPrimaryAssignmentStrategy : public FPrimaryAssignmentStrategy
 {
 public:
     virtual ISteerable* FindPrimary(const FSteeringFormation& Formation) override;
+
+    virtual SIZE_T GetAllocatedSize() const override
+    {
+        return sizeof(*this);
+    }
 };
 
 // Steering Formation Class
@@ -154,6 +181,7 @@ protected:
     FPSFormationPattern FormationPattern;
     FPSSlotAssignmentStrategy SlotAssignmentStrategy;
     FSlotAssignmentMap SlotMap;
+    uint32 SlotRevision;
     bool bRequirePatternUpdate;
 
     FFormationBehaviorList Behaviors;
@@ -174,6 +202,11 @@ protected:
     void UpdateBehavior(float DeltaTime);
     bool UpdateActiveBehavior(float DeltaTime);
 
+    // ~ Trace Functions
+
+    static FName GetTraceMemberName(ISteerable* Member);
+    void TraceSlotReassignment();
+
 public:
 
     FSteeringFormation();
@@ -255,6 +288,23 @@ public:
         return SlotMap;
     }
 
+    // Heap memory owned by the formation: member and slot containers, behaviors and utility objects.
+    // Does not include the formation object itself.
+    SIZE_T GetAllocatedSize() const;
+
+    // Incremented each time pattern and slot assignments are updated
+    FORCEINLINE uint32 GetSlotRevision() const
+    {
+        return SlotRevision;
+    }
+
+    // Assign members and slots directly, without running slot assignment strategy.
+    // Used to reconstruct formation from replicated slot assignments.
+    void SetSlotAssignments(const FSlotAssignmentMap& InSlotMap);
+
+    // Returns currently active formation behavior, if any
+    FFormationBehavior* GetActiveBehavior() const;
+
     // ~ Formation Member Functions
 
     int32 SetMembers(const TArray<ISteerable*>& InMembers);
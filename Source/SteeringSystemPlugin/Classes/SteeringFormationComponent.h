@@ -31,10 +31,86 @@
 #include "UObject/ObjectMacros.h"
 #include "Components/ActorComponent.h"
 #include "Components/SceneComponent.h"
+#include "Engine/NetSerialization.h"
 #include "IFormationProxy.h"
 #include "SteeringFormation.h"
 #include "SteeringFormationComponent.generated.h"
 
+class UVPSteerableComponent;
+
+/**
+ * Replicated formation member slot assignment.
+ */
+USTRUCT()
+struct STEERINGSYSTEMPLUGIN_API FSteeringFormationRepSlot
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	UVPSteerableComponent* Member;
+
+	UPROPERTY()
+	int32 SlotIndex;
+
+    FSteeringFormationRepSlot()
+        : Member(nullptr)
+        , SlotIndex(-1)
+    {
+    }
+
+    FSteeringFormationRepSlot(UVPSteerableComponent* InMember, int32 InSlotIndex)
+        : Member(InMember)
+        , SlotIndex(InSlotIndex)
+    {
+    }
+};
+
+/**
+ * Replicated formation intent. Clients reconstruct member movement
+ * from formation anchor, target and slot assignments instead of
+ * receiving per-member transforms at full rate.
+ */
+USTRUCT()
+struct STEERINGSYSTEMPLUGIN_API FSteeringFormationRepState
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FVector_NetQuantize10 AnchorLocation;
+
+	UPROPERTY()
+	FRotator AnchorRotation;
+
+	UPROPERTY()
+	FRotator Orientation;
+
+	UPROPERTY()
+	FVector_NetQuantize TargetLocation;
+
+	UPROPERTY()
+	float AnchorSpeed;
+
+	UPROPERTY()
+	float VelocityLimit;
+
+	UPROPERTY()
+	bool bHasTarget;
+
+	UPROPERTY()
+	TArray<FSteeringFormationRepSlot> Slots;
+
+    FSteeringFormationRepState()
+        : AnchorLocation(ForceInitToZero)
+        , AnchorRotation(ForceInitToZero)
+        , Orientation(ForceInitToZero)
+        , TargetLocation(ForceInitToZero)
+        , AnchorSpeed(0.f)
+        , VelocityLimit(0.f)
+        , bHasTarget(false)
+    {
+    }
+};
+
 UCLASS(ClassGroup=Movement, BlueprintType, meta=(BlueprintSpawnableComponent))
 class STEERINGSYSTEMPLUGIN_API USteeringFormationComponent : public UActorComponent, public IFormationProxy
 {
@@ -63,6 +139,39 @@ class STEERINGSYSTEMPLUGIN_API USteeringFormationComponent : public UActorCompon
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=SteeringFormation)
 	uint32 bAutoUpdateTickRegistration:1;
 
+	/**
+	 * If true, replicates formation intent (anchor, target and slot assignments) instead of relying on full rate member transform replication.
+	 * Clients reconstruct member movement locally and member actors net update frequency is lowered to MemberCorrectionNetUpdateFrequency.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="SteeringFormation|Networking")
+	uint32 bReplicateFormationIntent:1;
+
+	/** Net update frequency applied to formation member actors while replicating formation intent. Member snapshots only serve as corrections. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="SteeringFormation|Networking", meta=(ClampMin="0.1", UIMin="0.1", EditCondition="bReplicateFormationIntent"))
+	float MemberCorrectionNetUpdateFrequency;
+
+	/** Time in seconds for simulated members to close the distance to their formation slot. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="SteeringFormation|Networking", meta=(ClampMin="0.01", UIMin="0.01", EditCondition="bReplicateFormationIntent"))
+	float MemberSlotApproachTime;
+
+protected:
+
+	UPROPERTY(Transient, ReplicatedUsing=OnRep_ReplicatedFormationState)
+	FSteeringFormationRepState ReplicatedFormationState;
+
+	/** Original member actors net update frequency, restored when member leaves formation */
+	TMap<TWeakObjectPtr<AActor>, float> MemberNetUpdateFrequencies;
+
+    uint32 ReplicatedSlotRevision;
+
+	UFUNCTION()
+	virtual void OnRep_ReplicatedFormationState();
+
+    void UpdateReplicatedFormationState();
+    void UpdateMemberNetUpdateFrequencies();
+    void RestoreMemberNetUpdateFrequencies();
+    void SimulateFormation(float DeltaTime);
+
 public:
 
 	/** Assign the component we move and update. */
@@ -77,8 +186,13 @@ public:
 	virtual void InitializeComponent() override;
 	virtual void OnRegister() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 //END ActorComponent Interface 
 
+//BEGIN UObject Interface
+	virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
+//END UObject Interface
+
 // ~ Blueprint Functions
 
     /**
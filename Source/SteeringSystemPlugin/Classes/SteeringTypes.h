@@ -31,6 +31,8 @@
 #include "Components/SceneComponent.h"
 #include "GameFramework/Actor.h"
 #include "UObject/ObjectMacros.h"
+#include "VSteeringStats.h"
+#include "VSteeringTargetCache.h"
 #include "SteeringTypes.generated.h"
 
 typedef TSharedPtr<class FSteeringBehavior>     FPSSteeringBehavior;
@@ -43,6 +45,13 @@ typedef FFormationBehaviorList::TDoubleLinkedListNode   FFormationBehaviorListNo
 
 class ISteeringBehaviorBase
 {
+public:
+
+    ISteeringBehaviorBase()
+    {
+        INC_DWORD_STAT(STAT_VBehaviorAllocations);
+    }
+
 protected:
 
     // Whether the behavior has been initialized
@@ -88,50 +97,200 @@ public:
         return FName();
     }
 
+    // Size of the behavior object and its owned allocations, used for memory accounting
+    virtual SIZE_T GetAllocatedSize() const
+    {
+        return sizeof(ISteeringBehaviorBase);
+    }
+
     virtual bool HasValidData() const = 0;
+
+#if STATS
+
+    // Stats of the behavior type, looked up on first evaluation
+    FORCEINLINE const FVSteeringStats::FBehaviorStats& GetBehaviorStats() const
+    {
+        if (! BehaviorStats.CycleStat.IsValidStat())
+        {
+            BehaviorStats = FVSteeringStats::GetBehaviorStats(GetType());
+        }
+
+        return BehaviorStats;
+    }
+
+private:
+
+    mutable FVSteeringStats::FBehaviorStats BehaviorStats;
+
+#endif
 };
 
-USTRUCT(BlueprintType)
+UENUM()
+enum class ESteeringTargetType : uint8
+{
+    None,
+    Point,
+    Direction,
+    Component
+};
+
+/**
+ * Compact steering target: static point, direction or tracked component.
+ * Component targets read the transform shared through FVSteeringTargetCache, resolved once per frame.
+ * Copies and reads do not touch the cache and are safe from worker threads, setting a component target is game thread only.
+ *
+ * Note: Location, Rotation and TargetComponent are no longer Blueprint properties. Property redirects cannot map them
+ * to functions, Blueprints that used the old break or get pins must be reconnected to the BreakSteeringTarget node
+ * or the GetTargetLocation / GetTargetRotation / GetTargetComponent nodes in USteeringBehaviorUtility.
+ */
+USTRUCT(BlueprintType, meta=(HasNativeBreak="SteeringSystemPlugin.SteeringBehaviorUtility.BreakSteeringTarget"))
 struct STEERINGSYSTEMPLUGIN_API FSteeringTarget
 {
     GENERATED_USTRUCT_BODY()
 
-    UPROPERTY(BlueprintReadWrite, VisibleAnywhere)
-    FVector Location;
+private:
+
+    // Point location (XYZ), direction rotation (XYZW) or component location when the target was set
+    UPROPERTY()
+    FVector4 Vector;
+
+    UPROPERTY()
+    TWeakObjectPtr<USceneComponent> Component;
+
+    UPROPERTY()
+    ESteeringTargetType Type;
+
+public:
+
+    FSteeringTarget()
+        : Vector(0.f, 0.f, 0.f, 0.f)
+        , Type(ESteeringTargetType::None)
+    {
+    }
+
+    FSteeringTarget(const FVector& InLocation)
+    {
+        SetLocation(InLocation);
+    }
+
+    FSteeringTarget(const FQuat& InRotation)
+    {
+        SetRotation(InRotation);
+    }
+
+    FSteeringTarget(const FRotator& InRotation)
+    {
+        SetRotation(InRotation.Quaternion());
+    }
 
-    UPROPERTY(BlueprintReadWrite, VisibleAnywhere)
-    FQuat Rotation;
+    FSteeringTarget(USceneComponent* InComponent)
+    {
+        SetComponent(InComponent);
+    }
 
-    UPROPERTY(BlueprintReadWrite, VisibleAnywhere)
-    USceneComponent* TargetComponent = nullptr;
+    FORCEINLINE ESteeringTargetType GetType() const
+    {
+        return Type;
+    }
 
-    FSteeringTarget() = default;
+    FORCEINLINE void SetLocation(const FVector& InLocation)
+    {
+        Vector = FVector4(InLocation, 0.f);
+        Component = nullptr;
+        Type = ESteeringTargetType::Point;
+    }
 
-    FSteeringTarget(const FVector& InLocation) : Location(InLocation)
+    FORCEINLINE void SetRotation(const FQuat& InRotation)
     {
+        Vector = FVector4(InRotation.X, InRotation.Y, InRotation.Z, InRotation.W);
+        Component = nullptr;
+        Type = ESteeringTargetType::Direction;
     }
 
-    FSteeringTarget(const FQuat& InRotation) : Rotation(InRotation)
+    // Game thread only, tracks the component in the shared target cache
+    FORCEINLINE void SetComponent(USceneComponent* InComponent)
     {
+        if (IsValid(InComponent))
+        {
+            FVSteeringTargetCache::Track(InComponent);
+            Vector = FVector4(InComponent->GetComponentLocation(), 0.f);
+            Component = InComponent;
+            Type = ESteeringTargetType::Component;
+        }
+        else
+        {
+            Vector = FVector4(0.f, 0.f, 0.f, 0.f);
+            Component = nullptr;
+            Type = ESteeringTargetType::None;
+        }
     }
 
-    FSteeringTarget(const FRotator& InRotation) : Rotation(InRotation)
+    FORCEINLINE USceneComponent* GetComponent() const
     {
+        return (Type == ESteeringTargetType::Component) ? Component.Get() : nullptr;
     }
 
+    // Target location, zero for direction targets
     FORCEINLINE FVector GetLocation() const
     {
-        return IsValid(TargetComponent) ? TargetComponent->GetComponentLocation() : Location;
+        switch (Type)
+        {
+            case ESteeringTargetType::Point:
+                return FVector(Vector);
+
+            case ESteeringTargetType::Component:
+                return GetComponentEntry().Location;
+
+            default:
+                break;
+        }
+
+        return FVector::ZeroVector;
+    }
+
+    // Target rotation, identity for point targets
+    FORCEINLINE FQuat GetRotation() const
+    {
+        switch (Type)
+        {
+            case ESteeringTargetType::Direction:
+                return FQuat(Vector.X, Vector.Y, Vector.Z, Vector.W);
+
+            case ESteeringTargetType::Component:
+                return GetComponentEntry().Rotation;
+
+            default:
+                break;
+        }
+
+        return FQuat::Identity;
     }
 
     FORCEINLINE FVector GetForwardVector() const
     {
-        return IsValid(TargetComponent) ? TargetComponent->GetForwardVector() : Rotation.GetForwardVector();
+        return GetRotation().GetForwardVector();
     }
 
-    FORCEINLINE FQuat GetRotation() const
+private:
+
+    /**
+     * Resolve component transform without modifying the cache.
+     * Untracked components (loaded or replicated targets) are read directly,
+     * destroyed components keep the location of when the target was set.
+     */
+    FORCEINLINE FVSteeringTargetCache::FEntry GetComponentEntry() const
     {
-        return IsValid(TargetComponent) ? TargetComponent->GetComponentQuat() : Rotation;
+        if (const FVSteeringTargetCache::FEntry* Entry = FVSteeringTargetCache::Find(Component))
+        {
+            return *Entry;
+        }
+
+        if (const USceneComponent* Comp = Component.Get())
+        {
+            return { Comp->GetComponentLocation(), Comp->GetComponentQuat() };
+        }
+
+        return { FVector(Vector), FQuat::Identity };
     }
 };
 
@@ -0,0 +1,260 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+// 
+
+/**
+ * Closed form time parameterized movement components meant for use with SmoothDeltaActor.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectMacros.h"
+#include "VSmoothDeltaMovementComponent.h"
+#include "VAnalyticMovementComponent.generated.h"
+
+class UCurveVector;
+
+/**
+ * Base movement component for analytic paths evaluated in closed form from normalized simulation time.
+ * Path is evaluated relative to the owning actor movement source if set, otherwise relative to the updated component transform on begin play.
+ * The begin play transform of the server is replicated to simulated proxies, clients that receive the actor mid-path use the server path frame.
+ */
+UCLASS(Abstract, ClassGroup=Movement)
+class STEERINGSYSTEMPLUGIN_API UVAnalyticMovementComponent : public UVSmoothDeltaMovementComponent
+{
+	GENERATED_BODY()
+
+public:
+
+    UVAnalyticMovementComponent(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+    /** If true, updated component is oriented along the path tangent, otherwise origin rotation is kept. */
+    UPROPERTY(Category="Analytic Movement", EditAnywhere, BlueprintReadWrite)
+    bool bOrientToMovement;
+
+    /** If true, movement is swept and blocking hits are handled on the server. */
+    UPROPERTY(Category="Analytic Movement", EditAnywhere, BlueprintReadWrite)
+    bool bSweepMovement;
+
+    /** Event called after owning actor movement source changes. */
+    virtual void MovementSourceChange() override;
+
+    //Begin UActorComponent Interface
+    virtual void InitializeComponent() override;
+    virtual void BeginPlay() override;
+    //End UActorComponent Interface
+
+    virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+    /** Returns world space path transform at simulation time */
+    FTransform GetTransformAtTime(float InSimulationTime) const;
+
+    /** Returns approximate world space path length */
+    FORCEINLINE float GetPathLength() const
+    {
+        return PathLength;
+    }
+
+    /** Rebuild cached path data, call after modifying path properties at runtime */
+    UFUNCTION(BlueprintCallable, Category="Analytic Movement")
+    virtual void UpdatePath();
+
+protected:
+
+    /** Path frame used if the owning actor has no movement source, captured on the server and replicated to simulated proxies */
+    UPROPERTY(Transient, ReplicatedUsing=OnRep_OriginTransform)
+    FTransform OriginTransform;
+
+    /** Whether OriginTransform has been captured on the server or received from it */
+    bool bHasOrigin;
+
+    UFUNCTION()
+    virtual void OnRep_OriginTransform();
+
+    /** Approximate world space path length, used to clamp network smoothing */
+    float PathLength;
+
+    /** Number of segments used to approximate path length */
+    static const int32 PATH_LENGTH_SEGMENTS;
+
+    /**
+     * Evaluate local space path location and tangent at normalized time.
+     * @param Alpha         Normalized simulation time within [0..1]
+     * @param OutLocation   Local space location
+     * @param OutTangent    Local space movement direction, not required to be normalized
+     */
+    virtual void EvaluatePath(float Alpha, FVector& OutLocation, FVector& OutTangent) const;
+
+    /** Returns path frame transform */
+    FTransform GetPathFrame() const;
+
+    /** Actual server movement update implementation */
+    virtual void MovementUpdate(float DeltaTime) override;
+    virtual void MovementUpdateImpl(float DeltaTime, bool bHandleImpact);
+
+    /**
+     * Moves along the given movement direction using simple movement rules based on the current movement mode (usually used by simulated proxies).
+     */
+    virtual void MoveSmooth(float DeltaTime) override;
+    virtual void MoveSmooth_Visual() override;
+
+    /** Update transform to the current simulation time */
+    virtual void SnapToCurrentTime() override;
+
+    virtual float GetClampedSmoothSimulationOffset(float SimulationTimeDelta) const override;
+
+    FORCEINLINE bool HasValidPath() const
+    {
+        return Duration > MIN_TICK_TIME;
+    }
+};
+
+/**
+ * Circular orbit around the path frame origin on the frame XY plane.
+ */
+UCLASS(ClassGroup=Movement, meta=(BlueprintSpawnableComponent))
+class STEERINGSYSTEMPLUGIN_API UVOrbitMovementComponent : public UVAnalyticMovementComponent
+{
+	GENERATED_BODY()
+
+public:
+
+    UVOrbitMovementComponent(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+    /** Orbit radius. */
+    UPROPERTY(Category="Analytic Movement|Orbit", EditAnywhere, BlueprintReadWrite, meta=(ClampMin="0", UIMin="0"))
+    float Radius;
+
+    /** Orbit angle at the start of each cycle in degrees. */
+    UPROPERTY(Category="Analytic Movement|Orbit", EditAnywhere, BlueprintReadWrite)
+    float StartAngle;
+
+    /** Number of revolutions for each cycle. Negative values orbit clockwise. */
+    UPROPERTY(Category="Analytic Movement|Orbit", EditAnywhere, BlueprintReadWrite)
+    int32 Revolutions;
+
+protected:
+
+    virtual void EvaluatePath(float Alpha, FVector& OutLocation, FVector& OutTangent) const override;
+};
+
+/**
+ * Linear movement from start to end location and back each cycle.
+ */
+UCLASS(ClassGroup=Movement, meta=(BlueprintSpawnableComponent))
+class STEERINGSYSTEMPLUGIN_API UVPingPongMovementComponent : public UVAnalyticMovementComponent
+{
+	GENERATED_BODY()
+
+public:
+
+    UVPingPongMovementComponent(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+    /** Local space start location. */
+    UPROPERTY(Category="Analytic Movement|Ping Pong", EditAnywhere, BlueprintReadWrite, meta=(MakeEditWidget))
+    FVector StartLocation;
+
+    /** Local space end location. */
+    UPROPERTY(Category="Analytic Movement|Ping Pong", EditAnywhere, BlueprintReadWrite, meta=(MakeEditWidget))
+    FVector EndLocation;
+
+    /** If true, movement eases in and out at both ends. */
+    UPROPERTY(Category="Analytic Movement|Ping Pong", EditAnywhere, BlueprintReadWrite)
+    bool bEaseInOut;
+
+protected:
+
+    virtual void EvaluatePath(float Alpha, FVector& OutLocation, FVector& OutTangent) const override;
+};
+
+/**
+ * Cubic bezier curve movement from the first to the last control point each cycle.
+ */
+UCLASS(ClassGroup=Movement, meta=(BlueprintSpawnableComponent))
+class STEERINGSYSTEMPLUGIN_API UVBezierMovementComponent : public UVAnalyticMovementComponent
+{
+	GENERATED_BODY()
+
+public:
+
+    UVBezierMovementComponent(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+    /** Local space start point. */
+    UPROPERTY(Category="Analytic Movement|Bezier", EditAnywhere, BlueprintReadWrite, meta=(MakeEditWidget))
+    FVector StartPoint;
+
+    /** Local space start tangent control point. */
+    UPROPERTY(Category="Analytic Movement|Bezier", EditAnywhere, BlueprintReadWrite, meta=(MakeEditWidget))
+    FVector StartControlPoint;
+
+    /** Local space end tangent control point. */
+    UPROPERTY(Category="Analytic Movement|Bezier", EditAnywhere, BlueprintReadWrite, meta=(MakeEditWidget))
+    FVector EndControlPoint;
+
+    /** Local space end point. */
+    UPROPERTY(Category="Analytic Movement|Bezier", EditAnywhere, BlueprintReadWrite, meta=(MakeEditWidget))
+    FVector EndPoint;
+
+protected:
+
+    virtual void EvaluatePath(float Alpha, FVector& OutLocation, FVector& OutTangent) const override;
+};
+
+/**
+ * Vector curve movement over the full curve time range each cycle.
+ * Curve is sampled into a fixed rate table on UpdatePath() so evaluation does not search curve keys.
+ */
+UCLASS(ClassGroup=Movement, meta=(BlueprintSpawnableComponent))
+class STEERINGSYSTEMPLUGIN_API UVCurveMovementComponent : public UVAnalyticMovementComponent
+{
+	GENERATED_BODY()
+
+public:
+
+    UVCurveMovementComponent(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+    /** Local space location curve. */
+    UPROPERTY(Category="Analytic Movement|Curve", EditAnywhere, BlueprintReadOnly)
+    UCurveVector* LocationCurve;
+
+    /** Number of location curve samples. */
+    UPROPERTY(Category="Analytic Movement|Curve", EditAnywhere, BlueprintReadOnly, meta=(ClampMin="2", UIMin="2"))
+    int32 SampleCount;
+
+    /** Sets location curve and rebuilds curve samples. */
+    UFUNCTION(BlueprintCallable, Category="Analytic Movement|Curve")
+    void SetLocationCurve(UCurveVector* InLocationCurve);
+
+    virtual void UpdatePath() override;
+
+protected:
+
+    /** Location curve samples at fixed time intervals */
+    TArray<FVector> Samples;
+
+    virtual void EvaluatePath(float Alpha, FVector& OutLocation, FVector& OutTangent) const override;
+};
@@ -0,0 +1,85 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+// 
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Per agent RVO avoidance evaluation schedule.
+ *
+ * Movement components solve avoidance at an adaptive interval instead of every tick,
+ * reusing the last solved avoidance state in between. Only the local solve is throttled, RVO agents keep ticking
+ * and publishing their state to neighbors. Intervals shrink towards p.VAvoidanceMinInterval as avoidance deviates
+ * from the preferred velocity (crowded neighborhood) or changes quickly between solves (neighbors closing in),
+ * and grow towards p.VAvoidanceMaxInterval otherwise.
+ * Performed and skipped solves are counted in STATGROUP_Steering.
+ */
+class STEERINGSYSTEMPLUGIN_API FVAvoidanceSchedule
+{
+public:
+
+    FVAvoidanceSchedule()
+        : NextUpdateTime(0.f)
+        , UpdateInterval(0.f)
+        , LastAvoidanceVelocity(ForceInitToZero)
+    {
+    }
+
+    /**
+     * Returns true if avoidance should be solved at world time.
+     * Only call when a solve would otherwise be performed, the result is counted as a performed or skipped solve.
+     */
+    bool ShouldUpdate(float WorldTime) const;
+
+    /**
+     * Schedule next solve from the current avoidance state.
+     * @param WorldTime             Current world time
+     * @param PreferredVelocity     Velocity the agent would move at without avoidance, derived from control input
+     * @param AvoidanceVelocity     Current avoidance velocity
+     * @param MaxSpeed              Agent max speed, used to normalize velocity differences
+     * @return                      Interval until the next solve
+     */
+    float Schedule(float WorldTime, const FVector& PreferredVelocity, const FVector& AvoidanceVelocity, float MaxSpeed);
+
+    /** Solve avoidance on the next update */
+    void Reset();
+
+    FORCEINLINE float GetUpdateInterval() const
+    {
+        return UpdateInterval;
+    }
+
+    /** Whether avoidance throttling is enabled (p.VAvoidanceThrottle) */
+    static bool IsEnabled();
+
+private:
+
+    float NextUpdateTime;
+    float UpdateInterval;
+    FVector LastAvoidanceVelocity;
+};
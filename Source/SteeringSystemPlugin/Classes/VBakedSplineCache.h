@@ -0,0 +1,140 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+// 
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class USplineComponent;
+class UWorld;
+
+/**
+ * Immutable spline transform table sampled at uniform arc length intervals in spline local space.
+ * Sampling by normalized time is equivalent to USplineComponent transform queries with constant velocity,
+ * at the cost of a single indexed lerp.
+ */
+class STEERINGSYSTEMPLUGIN_API FVBakedSpline
+{
+public:
+
+    FVBakedSpline(const USplineComponent& Spline, float SampleDistance);
+
+    /** Sample local space location at spline time, using constant velocity spline reparameterization. */
+    FVector GetLocationAtTime(float SplineTime) const;
+
+    /** Sample local space rotation at spline time, using constant velocity spline reparameterization. */
+    FQuat GetQuaternionAtTime(float SplineTime) const;
+
+    /** Sample local space transform at spline time, using constant velocity spline reparameterization. */
+    FTransform GetTransformAtTime(float SplineTime) const;
+
+    /**
+     * Sample world space locations and rotations at multiple spline times in a single pass.
+     * Location and rotation interpolation and world space conversion are vectorized.
+     */
+    void GetWorldTransformsAtTimes(const FTransform& SplineTransform, const float* SplineTimes, int32 Count, FVector* OutLocations, FQuat* OutRotations) const;
+
+    FORCEINLINE uint32 GetVersion() const
+    {
+        return Version;
+    }
+
+    FORCEINLINE float GetSplineLength() const
+    {
+        return SplineLength;
+    }
+
+    FORCEINLINE float GetSplineDuration() const
+    {
+        return SplineDuration;
+    }
+
+    FORCEINLINE int32 GetSampleCount() const
+    {
+        return Locations.Num();
+    }
+
+    FORCEINLINE SIZE_T GetAllocatedSize() const
+    {
+        return Locations.GetAllocatedSize() + Rotations.GetAllocatedSize();
+    }
+
+private:
+
+    TArray<FVector> Locations;
+    TArray<FQuat> Rotations;
+    float SplineLength;
+    float SplineDuration;
+    float TimeToSample;
+    uint32 Version;
+
+    FORCEINLINE void GetSampleIndex(float SplineTime, int32& OutIndex, float& OutAlpha) const
+    {
+        const float SamplePosition = FMath::Clamp(SplineTime * TimeToSample, 0.f, (float) (Locations.Num()-1));
+        OutIndex = FMath::Min(FMath::FloorToInt(SamplePosition), Locations.Num()-2);
+        OutAlpha = SamplePosition - OutIndex;
+    }
+};
+
+typedef TSharedPtr<const FVBakedSpline> FPSBakedSpline;
+
+/**
+ * Shared baked spline cache keyed by spline component and spline curves version.
+ * Spline followers sharing a spline source share a single baked table.
+ */
+class STEERINGSYSTEMPLUGIN_API FVBakedSplineCache
+{
+public:
+
+    /** Get baked spline of the specified spline component, bake if not yet cached or out of date. */
+    static FPSBakedSpline GetBakedSpline(const USplineComponent* Spline);
+
+    /** Returns whether baked spline is out of date with its spline component. */
+    static bool IsOutdated(const FVBakedSpline& BakedSpline, const USplineComponent& Spline);
+
+    /** Remove cached entries of destroyed spline components. */
+    static void PurgeStaleEntries();
+
+    /** Remove cached entries of spline components in the specified world and of destroyed spline components. */
+    static void PurgeWorldEntries(const UWorld* World);
+
+    /** Clear all cached entries. */
+    static void Clear();
+
+    /** Returns total memory allocated by cached baked splines. */
+    static SIZE_T GetAllocatedSize();
+
+private:
+
+    struct FEntry
+    {
+        TWeakObjectPtr<const USplineComponent> Spline;
+        FPSBakedSpline BakedSpline;
+    };
+
+    static TMap<const USplineComponent*, FEntry> Entries;
+};
@@ -0,0 +1,101 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+// 
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectMacros.h"
+#include "Engine/EngineTypes.h"
+#include "Engine/NetSerialization.h"
+#include "VCompactRepMovement.generated.h"
+
+/**
+ * Compact replicated movement for large unit counts.
+ *
+ * Replicates 2D location as a grid cell index and quantized offset within the cell,
+ * yaw only rotation and quantized speed along the forward vector.
+ * Quantization settings are not replicated, they are expected to match class defaults on both server and client.
+ */
+USTRUCT()
+struct STEERINGSYSTEMPLUGIN_API FVCompactRepMovement
+{
+    GENERATED_USTRUCT_BODY()
+
+    /** Location in zero origin space. Z is only replicated if bReplicateZ is set. */
+    UPROPERTY(Transient)
+    FVector Location;
+
+    /** Yaw rotation in degrees. */
+    UPROPERTY(Transient)
+    float Yaw;
+
+    /** Speed along the yaw forward vector. */
+    UPROPERTY(Transient)
+    float ForwardSpeed;
+
+    /** Size of location grid cell. Location is replicated as cell index and quantized offset within the cell. */
+    UPROPERTY(EditDefaultsOnly, Category=Replication, AdvancedDisplay, meta=(ClampMin="1.0", UIMin="1.0"))
+    float CellSize;
+
+    /** Number of bits used to quantize location offset within the cell, per axis. */
+    UPROPERTY(EditDefaultsOnly, Category=Replication, AdvancedDisplay, meta=(ClampMin="4", ClampMax="20", UIMin="4", UIMax="20"))
+    int32 CellOffsetBits;
+
+    /** Forward speed quantization step, in units per second. */
+    UPROPERTY(EditDefaultsOnly, Category=Replication, AdvancedDisplay, meta=(ClampMin="0.01", UIMin="0.01"))
+    float SpeedQuantum;
+
+    /** Whether to replicate yaw as a byte instead of a short. */
+    UPROPERTY(EditDefaultsOnly, Category=Replication, AdvancedDisplay)
+    bool bCompressYawToByte;
+
+    /** Whether to replicate location Z. If not set, simulated proxies keep their current Z. */
+    UPROPERTY(EditDefaultsOnly, Category=Replication, AdvancedDisplay)
+    bool bReplicateZ;
+
+    FVCompactRepMovement();
+
+    bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+
+    /** Set compact movement from full replicated movement. */
+    void SetFromRepMovement(const FRepMovement& RepMovement);
+
+    /**
+     * Write compact movement to full replicated movement.
+     * Location Z is taken from the actor current location if bReplicateZ is not set.
+     */
+    void CopyToRepMovement(FRepMovement& RepMovement, const AActor* Actor) const;
+};
+
+template<>
+struct TStructOpsTypeTraits<FVCompactRepMovement> : public TStructOpsTypeTraitsBase2<FVCompactRepMovement>
+{
+    enum
+    {
+        WithNetSerializer = true
+    };
+};
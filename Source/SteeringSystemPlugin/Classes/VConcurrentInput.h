@@ -0,0 +1,76 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+// 
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Thread-safe control input accumulator.
+ *
+ * Input may be added from any thread without locks or allocations. Components are accumulated as 64 bit fixed point
+ * with atomic adds, integer addition is order independent so the merged input is deterministic regardless of the
+ * order producers ran in. Input is merged into the game thread input vector at a sync point by Consume(),
+ * producers are expected to have completed by then.
+ */
+class STEERINGSYSTEMPLUGIN_API FVConcurrentInputAccumulator
+{
+public:
+
+    FVConcurrentInputAccumulator()
+    {
+        Components[0] = 0;
+        Components[1] = 0;
+        Components[2] = 0;
+    }
+
+    /** Add input, may be called from any thread */
+    void Add(const FVector& Input);
+
+    /** Returns accumulated input and resets it to zero */
+    FVector Consume();
+
+    /** Returns accumulated input without resetting it */
+    FVector Peek() const;
+
+private:
+
+    /** Fixed point resolution, input units are usually between 0 and 1 in magnitude */
+    static const double FixedPointScale;
+
+    FORCEINLINE static int64 ToFixed(float Value)
+    {
+        return static_cast<int64>(FMath::FloorToDouble(static_cast<double>(Value) * FixedPointScale + .5));
+    }
+
+    FORCEINLINE static float FromFixed(int64 Value)
+    {
+        return static_cast<float>(static_cast<double>(Value) / FixedPointScale);
+    }
+
+    mutable volatile int64 Components[3];
+};
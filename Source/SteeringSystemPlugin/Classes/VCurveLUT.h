@@ -0,0 +1,94 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+// 
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UCurveFloat;
+
+/**
+ * Float curve lookup table sampled at uniform time intervals.
+ * Replaces per tick UCurveFloat::GetFloatValue() key searches with a single indexed lerp.
+ * Empty tables evaluate to the default value given on bake.
+ */
+class STEERINGSYSTEMPLUGIN_API FVCurveLUT
+{
+public:
+
+    FVCurveLUT()
+        : MinTime(0.f)
+        , TimeToIndex(0.f)
+        , DefaultValue(0.f)
+    {
+    }
+
+    /**
+     * Sample curve within time range. Table is emptied if curve is null.
+     * @param Curve         Curve to sample
+     * @param InMinTime     Table start time, lookups before it are clamped
+     * @param InMaxTime     Table end time, lookups after it are clamped
+     * @param SampleCount   Number of samples, at least two
+     * @param InDefaultValue Value returned by empty table
+     */
+    void Bake(const UCurveFloat* Curve, float InMinTime, float InMaxTime, int32 SampleCount, float InDefaultValue);
+
+    /** Discard samples, table evaluates to DefaultValue */
+    void Reset(float InDefaultValue);
+
+    /** Evaluate table at time */
+    FORCEINLINE float Evaluate(float Time) const
+    {
+        const int32 SampleNum = Samples.Num();
+
+        if (SampleNum < 2)
+        {
+            return DefaultValue;
+        }
+
+        const float SampleTime = FMath::Clamp((Time - MinTime) * TimeToIndex, 0.f, float(SampleNum-1));
+        const int32 Index = FMath::Min(FMath::TruncToInt(SampleTime), SampleNum-2);
+        return FMath::Lerp(Samples[Index], Samples[Index+1], SampleTime-Index);
+    }
+
+    FORCEINLINE bool IsEmpty() const
+    {
+        return Samples.Num() < 2;
+    }
+
+    FORCEINLINE SIZE_T GetAllocatedSize() const
+    {
+        return Samples.GetAllocatedSize();
+    }
+
+private:
+
+    TArray<float> Samples;
+    float MinTime;
+    float TimeToIndex;
+    float DefaultValue;
+};
@@ -0,0 +1,99 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+// 
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class USceneComponent;
+
+/**
+ * Fixed time step accumulator with visual interpolation between the last two simulation steps.
+ * Movement components feed frame delta time and perform the returned number of fixed steps,
+ * keeping per-step collision cost bounded and simulation independent of frame rate.
+ */
+class STEERINGSYSTEMPLUGIN_API FVFixedTimeStep
+{
+public:
+
+    FVFixedTimeStep()
+        : Accumulator(0.f)
+        , InterpAlpha(1.f)
+        , PreviousLocation(ForceInitToZero)
+        , PreviousRotation(FQuat::Identity)
+        , StepLocation(ForceInitToZero)
+        , bHasStepState(false)
+    {
+    }
+
+    /**
+     * Accumulate frame delta time and return the number of fixed steps to perform.
+     * Time in excess of MaxSteps is discarded, slowing down simulation instead of spiraling on hitches.
+     */
+    int32 Advance(float DeltaTime, float StepTime, int32 MaxSteps);
+
+    /** Record updated component transform before performing a fixed step. */
+    void SaveStepState(const USceneComponent& UpdatedComponent);
+
+    /** Discard interpolation state, visuals snap to the updated component (i.e. after teleport). Accumulated time is kept. */
+    void ResetStepState(const USceneComponent& UpdatedComponent);
+
+    /** Record updated component location after performing fixed steps of the current frame. */
+    void FinishSteps(const USceneComponent& UpdatedComponent);
+
+    /**
+     * Returns true if there is no step state yet, or if the updated component has been moved
+     * outside of fixed steps since the last FinishSteps() (i.e. teleported by SetActorLocation).
+     */
+    bool RequiresReset(const USceneComponent& UpdatedComponent) const;
+
+    /**
+     * Place visual component between the previous and current step transform of the updated component.
+     * BaseRelativeLocation and BaseRelativeRotation are the visual component default relative transform.
+     */
+    void UpdateVisualComponent(USceneComponent& VisualComponent, const USceneComponent& UpdatedComponent, const FVector& BaseRelativeLocation, const FQuat& BaseRelativeRotation) const;
+
+    FORCEINLINE void Reset()
+    {
+        Accumulator = 0.f;
+        InterpAlpha = 1.f;
+    }
+
+    FORCEINLINE float GetInterpAlpha() const
+    {
+        return InterpAlpha;
+    }
+
+private:
+
+    float Accumulator;
+    float InterpAlpha;
+    FVector PreviousLocation;
+    FQuat PreviousRotation;
+    FVector StepLocation;
+    bool bHasStepState;
+};
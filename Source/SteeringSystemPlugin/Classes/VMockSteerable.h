@@ -0,0 +1,160 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+// 
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ISteerable.h"
+#include "IFormationProxy.h"
+#include "SteeringTypes.h"
+#include "SteeringFormation.h"
+
+/**
+ * Plain data steerable, runs steering behaviors and formations without components or a world.
+ *
+ * Behaviors are evaluated the same way as UVPSteerableComponent evaluates them. Control input is integrated
+ * with simple kinematics: velocity follows control input scaled by max speed, orientation follows velocity.
+ * Intended for automation tests, microbenchmarks and offline evaluation of steering algorithms.
+ */
+class STEERINGSYSTEMPLUGIN_API FVMockSteerable : public ISteerable
+{
+public:
+
+    FVector Location;
+    FQuat Orientation;
+    FVector Velocity;
+    float InnerRadius;
+    float OuterRadius;
+    float MaxLinearSpeed;
+    float MaxLinearAcceleration;
+    float MinControlInput;
+    int32 Priority;
+
+    /** Control input of the last update */
+    FSteeringAcceleration ControlInput;
+
+    FVMockSteerable();
+    virtual ~FVMockSteerable();
+
+    /** Evaluate active behavior and integrate control input */
+    void Update(float DeltaTime);
+
+    FORCEINLINE int32 GetBehaviorCount() const
+    {
+        return Behaviors.Num();
+    }
+
+//BEGIN ISteerable Interface
+
+    virtual void AddSteeringBehavior(FPSSteeringBehavior InBehavior) override;
+    virtual void EnqueueSteeringBehavior(FPSSteeringBehavior InBehavior) override;
+    virtual void RemoveSteeringBehavior(FPSSteeringBehavior InBehavior) override;
+    virtual void ClearSteeringBehaviors() override;
+    virtual void SetFormation(FSteeringFormation* InFormation, bool bSetAsPrimary=false) override;
+    virtual void SetFormationDirect(FSteeringFormation* InFormation) override;
+    virtual FSteeringFormation* GetFormation() override;
+    virtual bool HasFormation() const override;
+    virtual FTickFunction* GetSteerableTickFunction() override;
+    virtual UObject* GetSteerableObject() override;
+    virtual FString GetSteerableName() const override;
+    virtual FVector GetSteerableLocation() const override;
+    virtual FQuat GetSteerableOrientation() const override;
+    virtual FVector GetForwardVector() const override;
+    virtual FVector GetLinearVelocity() const override;
+    virtual float GetInnerRadius() const override;
+    virtual float GetOuterRadius() const override;
+    virtual int32 GetPriority() const override;
+    virtual float GetMaxLinearSpeed() const override;
+    virtual float GetMaxLinearAcceleration() const override;
+    virtual float GetMinControlInput() const override;
+
+//END ISteerable Interface
+
+private:
+
+    FBehaviorList Behaviors;
+    FSteeringFormation* Formation;
+
+    bool UpdateActiveBehavior(float DeltaTime);
+    void ResetRegisteredBehavior(FPSSteeringBehavior& Behavior);
+};
+
+/**
+ * Plain data formation proxy, owns a formation and its anchor transform.
+ */
+class STEERINGSYSTEMPLUGIN_API FVMockFormationProxy : public IFormationProxy
+{
+public:
+
+    FVMockFormationProxy();
+    virtual ~FVMockFormationProxy();
+
+    FORCEINLINE FSteeringFormation& GetFormation()
+    {
+        return Formation;
+    }
+
+    void Update(float DeltaTime);
+
+//BEGIN IFormationProxy Interface
+
+    virtual void AddFormationBehavior(FPSFormationBehavior InBehavior) override;
+    virtual void EnqueueFormationBehavior(FPSFormationBehavior InBehavior) override;
+    virtual void RemoveFormationBehavior(FPSFormationBehavior InBehavior) override;
+    virtual void ClearFormationBehaviors() override;
+    virtual void AddMemberDependency(ISteerable* Member) override;
+    virtual void RemoveMemberDependency(ISteerable* Member) override;
+    virtual FVector GetAnchorLocation() const override;
+    virtual FQuat GetAnchorOrientation() const override;
+    virtual void SetAnchorLocationAndOrientation(const FVector& Location, const FQuat& Orientation) override;
+    virtual void SetAnchorLocation(const FVector& Location) override;
+    virtual void SetAnchorOrientation(const FQuat& Orientation) override;
+
+//END IFormationProxy Interface
+
+private:
+
+    FSteeringFormation Formation;
+    FVector AnchorLocation;
+    FQuat AnchorOrientation;
+};
+
+/**
+ * Steering throughput benchmark on mock steerables, does not require a world.
+ * Run with p.VSteeringBenchmark [AgentCount] [FormationSize] [FrameCount].
+ */
+class STEERINGSYSTEMPLUGIN_API FVSteeringBenchmark
+{
+public:
+
+    /**
+     * Simulate agents moving towards a target, grouped in formations of FormationSize members.
+     * Agents not in a formation (FormationSize of 1 or less) use arrive behaviors.
+     * @return Total simulation time in seconds
+     */
+    static double Run(int32 AgentCount, int32 FormationSize, int32 FrameCount, float DeltaTime = 1.f/30.f);
+};
@@ -0,0 +1,240 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+// 
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VOrientationIntegrator.h"
+
+/**
+ * Orientation policy rotating towards target direction at a limited turn rate.
+ */
+struct FVTurnRateOrientationPolicy
+{
+    static FORCEINLINE void InterpOrientation(FQuat& Orientation, const FVector& Current, const FVector& Target, float DeltaTime, float RotationSpeedDegrees)
+    {
+        FVOrientationIntegrator::InterpOrientation(Orientation, Current, Target, DeltaTime, RotationSpeedDegrees);
+    }
+};
+
+/**
+ * Integration policy with linear acceleration towards input max speed and linear deceleration.
+ */
+struct FVLinearIntegrationPolicy
+{
+    /** Accelerate velocity along direction up to input max speed, decelerate to match if over it */
+    static FORCEINLINE void Accelerate(FVector& Velocity, const FVector& Direction, float InputMaxSpeed, float MaxSpeed, float Acceleration, float Deceleration, float DeltaTime)
+    {
+        const float CurrentSpeed = FMath::Min(Velocity.Size(), MaxSpeed);
+        const float CurrentMaxSpeed = (InputMaxSpeed < MaxSpeed) ? InputMaxSpeed : MaxSpeed;
+
+        const float DecelerationDelta = FMath::Abs(Deceleration) * DeltaTime;
+        const float DecelerationThreshold = CurrentMaxSpeed + DecelerationDelta;
+
+        // Current speed has yet reached max speed, accelerate
+        if (CurrentSpeed < DecelerationThreshold)
+        {
+            const float AccelerationSpeed = CurrentSpeed + FMath::Abs(Acceleration)*DeltaTime;
+            Velocity = Direction * FMath::Min(AccelerationSpeed, CurrentMaxSpeed);
+        }
+        // Current speed has reached over max speed, decelerate to match
+        else
+        {
+            const float DecelerationSpeed = FMath::Max(Velocity.Size() - DecelerationDelta, 0.f);
+            Velocity = Direction * FMath::Max(DecelerationSpeed, CurrentMaxSpeed);
+        }
+    }
+
+    /** Dampen velocity magnitude based on deceleration */
+    static FORCEINLINE void Decelerate(FVector& Velocity, float Deceleration, float DeltaTime)
+    {
+        const float DecelerationDelta = FMath::Abs(Deceleration) * DeltaTime;
+
+        if (Velocity.SizeSquared() > DecelerationDelta)
+        {
+            const float DecelerationSpeed = FMath::Max(Velocity.Size() - DecelerationDelta, 0.f);
+            Velocity = Velocity.GetSafeNormal() * DecelerationSpeed;
+        }
+        // Velocity too low, set to zero
+        else
+        {
+            Velocity = FVector::ZeroVector;
+        }
+    }
+};
+
+/**
+ * Movement kernel shared by vessel and VPC movement components.
+ *
+ * Holds turn range state and performs turn rate limited orientation and velocity integration.
+ * Policies are resolved at compile time, only member functions actually used by a component are instantiated.
+ */
+template<typename TIntegrationPolicy, typename TOrientationPolicy>
+class TVMovementKernel
+{
+public:
+
+    typedef TIntegrationPolicy FIntegrationPolicy;
+    typedef TOrientationPolicy FOrientationPolicy;
+
+    TVMovementKernel()
+        : TurnRate(0.f)
+        , MinTurnRate(0.f)
+        , TurnAcceleration(0.f)
+        , bUseTurnRange(false)
+        , CurrentTurnRate(0.f)
+        , TurnInterpRangeInv(0.f)
+        , LastTurnDelta(ForceInitToZero)
+    {
+    }
+
+    /**
+     * Update turn rate settings and reset turn range state.
+     * Turn range is used if MinTurnRate is positive and less than TurnRate, with positive TurnAcceleration.
+     */
+    void RefreshTurnRange(float InTurnRate, float InMinTurnRate, float InTurnAcceleration)
+    {
+        TurnRate = InTurnRate;
+        MinTurnRate = InMinTurnRate;
+        TurnAcceleration = InTurnAcceleration;
+
+        bUseTurnRange = (MinTurnRate > 0.f) && (MinTurnRate < TurnRate) && (TurnAcceleration > 0.f);
+
+        if (bUseTurnRange)
+        {
+            TurnInterpRangeInv = 1.f / (TurnRate-MinTurnRate);
+            ClearTurnRange();
+        }
+        else
+        {
+            CurrentTurnRate = TurnRate;
+        }
+    }
+
+    /** Accelerate current turn rate if turning towards the same direction since last update, otherwise reset it */
+    void PrepareTurnRange(float DeltaTime, const FVector& VelocityNormal, const FVector& InputNormal)
+    {
+        // turn range is not enabled, directly set current turn rate and return
+        if (! bUseTurnRange)
+        {
+            if (CurrentTurnRate < TurnRate)
+            {
+                CurrentTurnRate = TurnRate;
+            }
+            return;
+        }
+
+        if (LastTurnDelta.SizeSquared() > 0.f)
+        {
+            FVector TurnDelta = InputNormal - VelocityNormal;
+
+            // Turning towards the same direction since last update, accelerate turn rate
+            if ((LastTurnDelta|TurnDelta) > 0.f)
+            {
+                // Update turn rate if not yet reached maximum turn rate
+                if (CurrentTurnRate < TurnRate)
+                {
+                    const float TurnInterpAlpha = ((CurrentTurnRate-MinTurnRate) + TurnAcceleration*DeltaTime) * TurnInterpRangeInv;
+                    const float TurnInterpSpeed = FMath::Lerp(MinTurnRate, TurnRate, FMath::Clamp(TurnInterpAlpha, 0.f, 1.f));
+                    CurrentTurnRate = FMath::Min(TurnInterpSpeed, TurnRate);
+                }
+            }
+            // Turning towards the opposite direction from last update, reset turn rate
+            else
+            {
+                ClearTurnRange();
+            }
+
+            LastTurnDelta = TurnDelta;
+        }
+        else
+        {
+            ClearTurnRange();
+            LastTurnDelta = (InputNormal-VelocityNormal).GetSafeNormal();
+        }
+    }
+
+    /** Reset current turn rate to minimum turn rate */
+    void ClearTurnRange()
+    {
+        if (bUseTurnRange && CurrentTurnRate > MinTurnRate)
+        {
+            CurrentTurnRate = MinTurnRate;
+            LastTurnDelta = FVector::ZeroVector;
+        }
+    }
+
+    /** Rotate orientation forward towards normalized target direction using current turn rate */
+    void Orient(FQuat& Orientation, const FVector& TargetNormal, float DeltaTime)
+    {
+        const FVector ForwardNormal = Orientation.GetForwardVector();
+
+        // Interpolate velocity direction
+        if (! FVector::Coincident(ForwardNormal, TargetNormal))
+        {
+            PrepareTurnRange(DeltaTime, ForwardNormal, TargetNormal);
+        }
+        // Set direction directly if above dot threshold
+        else
+        {
+            ClearTurnRange();
+        }
+
+        FOrientationPolicy::InterpOrientation(Orientation, ForwardNormal, TargetNormal, DeltaTime, CurrentTurnRate);
+    }
+
+    FORCEINLINE void Accelerate(FVector& Velocity, const FVector& Direction, float InputMaxSpeed, float MaxSpeed, float Acceleration, float Deceleration, float DeltaTime) const
+    {
+        FIntegrationPolicy::Accelerate(Velocity, Direction, InputMaxSpeed, MaxSpeed, Acceleration, Deceleration, DeltaTime);
+    }
+
+    FORCEINLINE void Decelerate(FVector& Velocity, float Deceleration, float DeltaTime) const
+    {
+        FIntegrationPolicy::Decelerate(Velocity, Deceleration, DeltaTime);
+    }
+
+    FORCEINLINE float GetCurrentTurnRate() const
+    {
+        return CurrentTurnRate;
+    }
+
+private:
+
+    // Turn rate settings
+    float TurnRate;
+    float MinTurnRate;
+    float TurnAcceleration;
+
+    // Turn range properties
+    bool bUseTurnRange;
+    float CurrentTurnRate;
+    float TurnInterpRangeInv;
+    FVector LastTurnDelta;
+};
+
+/** Movement kernel used by vessel and VPC movement components */
+typedef TVMovementKernel<FVLinearIntegrationPolicy, FVTurnRateOrientationPolicy> FVMovementKernel;
@@ -0,0 +1,202 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+// 
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectMacros.h"
+#include "VOrcaSolver.generated.h"
+
+class UWorld;
+
+/**
+ * Built-in ORCA avoidance agent settings.
+ */
+USTRUCT(BlueprintType)
+struct STEERINGSYSTEMPLUGIN_API FVOrcaAgentSettings
+{
+    GENERATED_USTRUCT_BODY()
+
+    /** Agent avoidance radius. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Avoidance, meta=(ClampMin="0", UIMin="0"))
+    float Radius;
+
+    /** Maximum distance of other agents taken into account. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Avoidance, meta=(ClampMin="0", UIMin="0"))
+    float NeighborDistance;
+
+    /** Maximum number of closest agents taken into account. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Avoidance, meta=(ClampMin="1", UIMin="1", ClampMax="32", UIMax="32"))
+    int32 MaxNeighbors;
+
+    /** Minimal amount of time for which computed velocities are safe with respect to other agents. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Avoidance, meta=(ClampMin="0.01", UIMin="0.01"))
+    float TimeHorizon;
+
+    FVOrcaAgentSettings()
+        : Radius(50.f)
+        , NeighborDistance(500.f)
+        , MaxNeighbors(10)
+        , TimeHorizon(1.f)
+    {
+    }
+};
+
+/**
+ * Built-in 2D ORCA (optimal reciprocal collision avoidance) solver.
+ *
+ * Alternative to the per agent RVO3D agent component. One solver exists per world,
+ * agents push their state on their own movement update and the solver computes avoidance velocities
+ * of all registered agents in a single batched pass, once per frame, on first avoidance velocity query.
+ * Neighbors are gathered from a uniform grid rebuilt on every pass, agents are solved in parallel.
+ *
+ * Avoidance is solved on the XY plane, the Z component of the preferred velocity is kept as is.
+ * Agents that push their state after the pass of the current frame are solved with that state on the next frame.
+ */
+class STEERINGSYSTEMPLUGIN_API FVOrcaSolver
+{
+public:
+
+    FVOrcaSolver(const UWorld* InWorld);
+
+    int32 AddAgent();
+    void RemoveAgent(int32 AgentId);
+
+    /** Update agent state used by the next solver pass */
+    void SetAgentState(int32 AgentId, const FVector& Location, const FVector& Velocity, const FVector& PreferredVelocity, float MaxSpeed, const FVOrcaAgentSettings& Settings);
+
+    /**
+     * Get agent avoidance velocity, solve all agents if not yet solved in the current frame.
+     * Returns true if the avoidance velocity diverts from the agent preferred velocity.
+     */
+    bool GetAvoidanceVelocity(int32 AgentId, FVector& OutVelocity);
+
+    /** Solve avoidance velocities of all agents, does nothing if already solved in the current frame */
+    void Solve();
+
+    FORCEINLINE int32 Num() const
+    {
+        return Agents.Num();
+    }
+
+private:
+
+    struct FAgent
+    {
+        FVector2D Location;
+        FVector2D Velocity;
+        FVector2D PreferredVelocity;
+        FVector2D AvoidanceVelocity;
+        float PreferredVelocityZ;
+        float MaxSpeed;
+        FVOrcaAgentSettings Settings;
+        bool bHasState;
+        bool bHasAvoidance;
+    };
+
+    struct FLine
+    {
+        FVector2D Point;
+        FVector2D Direction;
+    };
+
+    void SolveAgent(int32 DenseIndex, float InvTimeStep);
+    void GatherNeighbors(int32 DenseIndex, TArray<int32, TInlineAllocator<32>>& OutNeighbors) const;
+
+    FORCEINLINE FIntPoint GetCell(const FVector2D& Location) const
+    {
+        return FIntPoint(FMath::FloorToInt(Location.X * InvCellSize), FMath::FloorToInt(Location.Y * InvCellSize));
+    }
+
+    static bool LinearProgram1(const TArray<FLine, TInlineAllocator<32>>& Lines, int32 LineNo, float Radius, const FVector2D& OptVelocity, bool bDirectionOpt, FVector2D& Result);
+    static int32 LinearProgram2(const TArray<FLine, TInlineAllocator<32>>& Lines, float Radius, const FVector2D& OptVelocity, bool bDirectionOpt, FVector2D& Result);
+    static void LinearProgram3(const TArray<FLine, TInlineAllocator<32>>& Lines, int32 BeginLine, float Radius, FVector2D& Result);
+
+    TWeakObjectPtr<const UWorld> World;
+    TSparseArray<FAgent> Agents;
+
+    // Solver pass data, indexed by dense index
+    TArray<int32> DenseAgents;
+
+    // Neighbor index, dense indices of agents keyed by grid cell
+    TMap<FIntPoint, TArray<int32>> Grid;
+    float InvCellSize;
+
+    uint64 SolvedFrame;
+
+public:
+
+    /** Get solver of the specified world, create solver if required */
+    static TSharedPtr<FVOrcaSolver> Register(const UWorld* InWorld);
+
+    /** Release solver of the specified world if it has no agents left */
+    static void Unregister(const UWorld* InWorld);
+
+private:
+
+    static TMap<const UWorld*, TSharedPtr<FVOrcaSolver>> Solvers;
+};
+
+typedef TSharedPtr<FVOrcaSolver> FPSOrcaSolver;
+
+/**
+ * Built-in ORCA solver agent registration owned by a movement component.
+ */
+class STEERINGSYSTEMPLUGIN_API FVOrcaAgentHandle
+{
+public:
+
+    FVOrcaAgentHandle()
+        : World(nullptr)
+        , AgentId(INDEX_NONE)
+    {
+    }
+
+    ~FVOrcaAgentHandle()
+    {
+        Unregister();
+    }
+
+    void Register(const UWorld* InWorld);
+    void Unregister();
+
+    FORCEINLINE bool IsRegistered() const
+    {
+        return Solver.IsValid() && AgentId != INDEX_NONE;
+    }
+
+    void SetState(const FVector& Location, const FVector& Velocity, const FVector& PreferredVelocity, float MaxSpeed, const FVOrcaAgentSettings& Settings) const;
+
+    /** Returns true if the avoidance velocity diverts from the preferred velocity */
+    bool GetAvoidanceVelocity(FVector& OutVelocity) const;
+
+private:
+
+    FPSOrcaSolver Solver;
+    const UWorld* World;
+    int32 AgentId;
+};
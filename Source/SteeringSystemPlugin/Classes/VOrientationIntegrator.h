@@ -0,0 +1,87 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+// 
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Turn rate limited orientation integrator shared by vessel and VPC movement.
+ *
+ * Rotates orientations towards target forward directions by at most turn rate * delta time.
+ * Avoids axis-angle decomposition: the step limit is tested against the shortest arc quaternion W,
+ * and the rotation axis is rescaled to the step half angle, so the only trigonometry per agent is the step sine/cosine.
+ * Step half angle is clamped to [0, PI/2], its sine and cosine are evaluated with fixed polynomials without range reduction,
+ * absolute error is below 4e-6 for the sine and below 6e-7 for the cosine.
+ */
+class STEERINGSYSTEMPLUGIN_API FVOrientationIntegrator
+{
+public:
+
+    /**
+     * Rotate orientation from current towards target forward direction using turn rate limit.
+     * @param Orientation           Orientation to rotate
+     * @param Current               Normalized current forward direction
+     * @param Target                Normalized target forward direction
+     * @param DeltaTime             Time step
+     * @param RotationSpeedDegrees  Turn rate in degrees per second
+     */
+    static void InterpOrientation(FQuat& Orientation, const FVector& Current, const FVector& Target, float DeltaTime, float RotationSpeedDegrees);
+
+private:
+
+    /** Returns rotation step half angle, clamped to half turn */
+    static FORCEINLINE float GetHalfStepRadians(float DeltaTime, float RotationSpeedDegrees)
+    {
+        return FMath::Clamp(RotationSpeedDegrees * (PI / 360.f) * DeltaTime, 0.f, HALF_PI);
+    }
+
+    /** Evaluate sine and cosine of half angle within [0, PI/2], degree 9 and 10 Taylor polynomials */
+    static FORCEINLINE void HalfStepSinCos(float HalfStep, float& OutSin, float& OutCos)
+    {
+        const float X2 = HalfStep * HalfStep;
+        OutSin = HalfStep * (1.f + X2 * (-1.f/6.f + X2 * (1.f/120.f + X2 * (-1.f/5040.f + X2 * (1.f/362880.f)))));
+        OutCos = 1.f + X2 * (-.5f + X2 * (1.f/24.f + X2 * (-1.f/720.f + X2 * (1.f/40320.f + X2 * (-1.f/3628800.f)))));
+    }
+
+    /** Rotate orientation towards target using precomputed rotation step half angle sine and cosine */
+    static FORCEINLINE void RotateTowards(FQuat& Orientation, const FVector& Current, const FVector& Target, float HalfStepSin, float HalfStepCos)
+    {
+        // Find delta rotation between both normals.
+        FQuat DeltaQuat = FQuat::FindBetweenNormals(Current, Target);
+
+        // Delta angle exceeds rotation step, both half angles are within [0, PI/2] so compare cosines
+        if (DeltaQuat.W < HalfStepCos)
+        {
+            // Rescale rotation axis to rotation step half angle sine
+            const float AxisScale = HalfStepSin * FMath::InvSqrt(DeltaQuat.X*DeltaQuat.X + DeltaQuat.Y*DeltaQuat.Y + DeltaQuat.Z*DeltaQuat.Z);
+            DeltaQuat = FQuat(DeltaQuat.X*AxisScale, DeltaQuat.Y*AxisScale, DeltaQuat.Z*AxisScale, HalfStepCos);
+        }
+
+        Orientation = DeltaQuat * Orientation;
+    }
+};
@@ -37,6 +37,10 @@
 #include "Interfaces/NetworkPredictionInterface.h"
 #include "VPMovementComponent.h"
 #include "VPCMovementTypes.h"
+#include "VFixedTimeStep.h"
+#include "VMovementKernel.h"
+#include "VAvoidanceSchedule.h"
+#include "VOrcaSolver.h"
 #include "VPCMovementComponent.generated.h"
 
 class AVPawnChar;
@@ -213,6 +217,22 @@ public:
     UPROPERTY()
     uint32 bForceMaxAccel:1;    
 
+    /**
+     * If true, authority movement is performed in fixed time steps instead of variable frame delta time.
+     * Keeps per-step collision cost bounded on hitches and makes movement reproducible. Mesh root is interpolated between steps.
+     * @see FixedTimeStep, MaxFixedTimeSteps
+     */
+    UPROPERTY(Category="Character Movement (Fixed Time Step)", EditAnywhere, AdvancedDisplay)
+    uint32 bUseFixedTimeStep:1;
+
+    /** Simulation step time in seconds used by fixed time step movement. */
+    UPROPERTY(Category="Character Movement (Fixed Time Step)", EditAnywhere, AdvancedDisplay, meta=(ClampMin="0.001", UIMin="0.001", EditCondition="bUseFixedTimeStep"))
+    float FixedTimeStep;
+
+    /** Maximum number of fixed steps performed in a single frame. Accumulated time over this limit is discarded. */
+    UPROPERTY(Category="Character Movement (Fixed Time Step)", EditAnywhere, AdvancedDisplay, meta=(ClampMin="1", UIMin="1", EditCondition="bUseFixedTimeStep"))
+    int32 MaxFixedTimeSteps;
+
     /**
      * Signals that smoothed position/rotation has reached target, and no more smoothing is necessary until a future update.
      * This is used as an optimization to skip calls to SmoothClientPosition() when true. SmoothCorrection() sets it false when a new network update is received.
@@ -304,6 +324,13 @@ protected:
     UPROPERTY()
     FVector LastUpdateVelocity;
 
+    /**
+     * Control input consumed this frame by a simulated proxy, e.g. supplied by a replicated formation.
+     * Used by SimulateMovement() to steer velocity between server corrections.
+     */
+    UPROPERTY(Transient)
+    FVector SimulatedInputVector;
+
     /** Timestamp when location or rotation last changed during an update. Only valid on the server. */
     UPROPERTY(Transient)
     float ServerLastTransformUpdateTimeStamp;
@@ -415,6 +442,32 @@ public:
     UPROPERTY(Category="Character Movement (Networking)", EditDefaultsOnly, AdvancedDisplay, meta=(ClampMin="0.0", ClampMax="1.0", UIMin="0.0", UIMax="1.0"))
     float ListenServerNetworkSimulatedSmoothRotationTime;
 
+    /**
+     * Whether to scale network smoothing cost of simulated proxies by view distance and visibility.
+     * @see NetworkSmoothingLODReducedDistance, NetworkSmoothingLODSnapDistance, NetworkSmoothingLODReducedInterval
+     */
+    UPROPERTY(Category="Character Movement (Networking)", EditDefaultsOnly, AdvancedDisplay)
+    bool bEnableNetworkSmoothingLOD;
+
+    /** Distance from the closest local view beyond which smoothing is updated at reduced rate. Hidden proxies always use reduced rate. */
+    UPROPERTY(Category="Character Movement (Networking)", EditDefaultsOnly, AdvancedDisplay, meta=(ClampMin="0.0", UIMin="0.0", EditCondition="bEnableNetworkSmoothingLOD"))
+    float NetworkSmoothingLODReducedDistance;
+
+    /** Distance from the closest local view beyond which network updates are snapped without smoothing. */
+    UPROPERTY(Category="Character Movement (Networking)", EditDefaultsOnly, AdvancedDisplay, meta=(ClampMin="0.0", UIMin="0.0", EditCondition="bEnableNetworkSmoothingLOD"))
+    float NetworkSmoothingLODSnapDistance;
+
+    /** Smoothing update interval, in seconds, used by reduced rate smoothing. */
+    UPROPERTY(Category="Character Movement (Networking)", EditDefaultsOnly, AdvancedDisplay, meta=(ClampMin="0.0", ClampMax="1.0", UIMin="0.0", UIMax="1.0", EditCondition="bEnableNetworkSmoothingLOD"))
+    float NetworkSmoothingLODReducedInterval;
+
+    /**
+     * Number of replay samples preallocated per simulated proxy for replay smoothing.
+     * Should cover the replay sample rate over the retained sample window, older samples are discarded when full.
+     */
+    UPROPERTY(Category="Character Movement (Networking)", EditDefaultsOnly, AdvancedDisplay, meta=(ClampMin="2", UIMin="2"))
+    int32 NetworkReplaySampleCapacity;
+
 public:
 
     /**
@@ -454,7 +507,7 @@ protected:
 
 public:
 
-    /** If true, search for the owner's RVO agent component as the RVOAgentComponent if there is not one currently assigned. */
+    /** If true, search for the owner's RVO agent component as the RVOAgentComponent if there is not one currently assigned. Ignored with built-in avoidance. */
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=Component)
     bool bAutoRegisterRVOAgentComponent;
 
@@ -462,6 +515,14 @@ public:
     UPROPERTY(Category="Character Movement (Avoidance)", EditAnywhere, BlueprintReadOnly)
     uint32 bUseRVOAvoidance:1;
 
+    /** If set, avoidance is solved by the plugin built-in ORCA solver instead of the RVO agent component. */
+    UPROPERTY(Category="Character Movement (Avoidance)", EditAnywhere, BlueprintReadOnly)
+    uint32 bUseBuiltInAvoidance:1;
+
+    /** Built-in ORCA avoidance agent settings. */
+    UPROPERTY(Category="Character Movement (Avoidance)", EditAnywhere, BlueprintReadWrite, meta=(EditCondition="bUseBuiltInAvoidance"))
+    FVOrcaAgentSettings BuiltInAvoidanceSettings;
+
     /** Whether current RVO performed with ZeroVelocityRVOThreshold velocity */
     UPROPERTY(Category="Character Movement (Avoidance)", EditAnywhere, BlueprintReadOnly)
     uint32 bZeroVelocityRVO:1;
@@ -515,6 +576,7 @@ public:
     //Begin UActorComponent Interface
     virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction) override;
     virtual void OnRegister() override;
+    virtual void OnUnregister() override;
     virtual void BeginDestroy() override;
     virtual void PostLoad() override;
     virtual void Deactivate() override;
@@ -522,6 +584,10 @@ public:
     virtual void ApplyWorldOffset(const FVector& InOffset, bool bWorldShift) override;
     //End UActorComponent Interface
 
+    //Begin UObject Interface
+    virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
+    //End UObject Interface
+
     //BEGIN UMovementComponent Interface
     virtual float GetMaxSpeed() const override;
     virtual float GetGravityZ() const override;
@@ -832,11 +898,8 @@ protected:
     UPROPERTY(EditAnywhere, Category="Character Movement (Orientation)", meta=(ClampMin="0", UIMin="0"))
     float TurnAcceleration;
 
-    // Turn range properties
-    bool bUseTurnRange;
-    float CurrentTurnRate;
-    float TurnInterpRangeInv;
-    FVector LastTurnDelta;
+    // Turn range state and orientation integration
+    FVMovementKernel MovementKernel;
 
     // Velocity orientation, implicitly updated component orientation
     FQuat VelocityOrientation;
@@ -845,9 +908,6 @@ protected:
     bool bLockedOrientation;
 
     void RefreshTurnRange();
-    void PrepareTurnRange(float DeltaTime, const FVector& VelocityNormal, const FVector& InputNormal);
-    void ClearTurnRange();
-    static void InterpOrientation(FQuat& Orientation, const FVector& Current, const FVector& Target, float DeltaTime, float RotationSpeedDegrees);
 
 protected:
 
@@ -859,6 +919,12 @@ protected:
     /** Perform movement on an autonomous client */
     virtual void PerformMovement(float DeltaTime);
 
+    /** Perform movement in fixed time steps and interpolate mesh root between steps. Used if bUseFixedTimeStep is true. */
+    virtual void PerformFixedTimeStepMovement(float DeltaTime);
+
+    /** Fixed time step accumulator and interpolation state */
+    FVFixedTimeStep FixedTimeStepState;
+
     /** Special Tick for Simulated Proxies */
     void SimulatedTick(float DeltaTime);
 
@@ -931,6 +997,15 @@ protected:
     /** Update mesh location based on interpolated values. */
     void SmoothClientPosition_UpdateVisuals();
 
+    /** Snap mesh offsets to the latest network update and mark smoothing as complete. */
+    void SmoothClientPosition_Snap();
+
+    /**
+     * Calculate network smoothing level of detail from distance to the closest local view, proxy visibility and the global per-frame smoothing budget.
+     * Full rate requests consume the per-frame budget and are demoted to reduced rate once it is exhausted.
+     */
+    EVPCSmoothingLOD CalcNetworkSmoothingLOD() const;
+
     /*
     ========================================================================
     Here's how player movement prediction, replication and correction works in network games:
@@ -983,6 +1058,9 @@ public:
 
 protected:
 
+    /** Get avoidance velocity from the active avoidance solver. Returns false if there is no avoidance override. */
+    bool GetAvoidanceVelocity(FVector& OutVelocity) const;
+
     // RVO
 
     /** if set, PostProcessAvoidanceVelocity will be called */
@@ -995,6 +1073,12 @@ protected:
     UPROPERTY(BlueprintReadOnly, Transient, DuplicateTransient)
     URVO3DAgentComponent* RVOAgentComponent;
 
+    /** Adaptive avoidance evaluation schedule */
+    FVAvoidanceSchedule AvoidanceSchedule;
+
+    /** Built-in avoidance solver agent */
+    FVOrcaAgentHandle AvoidanceAgent;
+
 public:
 
     /** Minimum delta time considered when ticking. Delta times below this are not considered. This is a very small non-zero value to avoid potential divide-by-zero in simulation code. */
@@ -81,6 +81,17 @@ struct TStructOpsTypeTraits<FVPCMovementComponentPostPhysicsTickFunction> : publ
     };
 };
 
+/** Network smoothing level of detail of a simulated proxy */
+enum class EVPCSmoothingLOD : uint8
+{
+    /** Interpolate and update visuals every frame */
+    Full,
+    /** Interpolate and update visuals at a reduced rate */
+    Reduced,
+    /** Snap to the latest network update without interpolation */
+    Snap
+};
+
 class FVPCReplaySample
 {
 public:
@@ -97,6 +108,94 @@ public:
     float           Time;                   // This represents time since replay started
 };
 
+/**
+ * Fixed capacity ring buffer of replay samples ordered by time.
+ * Storage is allocated once on SetCapacity(), adding to a full buffer discards the oldest sample.
+ * Sample bracket lookup uses cached cursor from the previous lookup, falling back to binary search.
+ */
+class STEERINGSYSTEMPLUGIN_API FVPCReplaySampleBuffer
+{
+public:
+
+    FVPCReplaySampleBuffer()
+        : Head(0)
+        , Count(0)
+        , Cursor(0)
+    {
+    }
+
+    /** Allocate sample storage. Existing samples are discarded. */
+    void SetCapacity(int32 InCapacity);
+
+    /** Append sample, samples older than the last sample reset the buffer (replay scrubbing). */
+    void Add(const FVPCReplaySample& Sample);
+
+    /** Remove samples from the front of the buffer. */
+    void RemoveFirst(int32 RemoveCount = 1);
+
+    /** Remove all samples, preserving storage. */
+    FORCEINLINE void Reset()
+    {
+        Head = 0;
+        Count = 0;
+        Cursor = 0;
+    }
+
+    /**
+     * Find sample index i where [i].Time <= Time <= [i+1].Time.
+     * @return Sample bracket start index, INDEX_NONE if Time is out of sample range.
+     */
+    int32 FindBracket(float Time);
+
+    /** Find index of sample with the closest time, INDEX_NONE if empty. */
+    int32 FindNearest(float Time) const;
+
+    FORCEINLINE int32 Num() const
+    {
+        return Count;
+    }
+
+    FORCEINLINE int32 Max() const
+    {
+        return Samples.Num();
+    }
+
+    FORCEINLINE FVPCReplaySample& operator[](int32 Index)
+    {
+        checkSlow(Index >= 0 && Index < Count);
+        return Samples[GetStorageIndex(Index)];
+    }
+
+    FORCEINLINE const FVPCReplaySample& operator[](int32 Index) const
+    {
+        checkSlow(Index >= 0 && Index < Count);
+        return Samples[GetStorageIndex(Index)];
+    }
+
+    FORCEINLINE const FVPCReplaySample& Last() const
+    {
+        return (*this)[Count-1];
+    }
+
+    FORCEINLINE SIZE_T GetAllocatedSize() const
+    {
+        return Samples.GetAllocatedSize();
+    }
+
+private:
+
+    TArray<FVPCReplaySample> Samples;
+    int32 Head;
+    int32 Count;
+    int32 Cursor;
+
+    FORCEINLINE int32 GetStorageIndex(int32 Index) const
+    {
+        const int32 StorageIndex = Head + Index;
+        return (StorageIndex < Samples.Num()) ? StorageIndex : (StorageIndex - Samples.Num());
+    }
+};
+
 class STEERINGSYSTEMPLUGIN_API FNetworkPredictionData_Client_VPC : public FNetworkPredictionData_Client, protected FNoncopyable
 {
 public:
@@ -170,6 +269,9 @@ public:
      */
     float MaxMoveDeltaTime;
 
+    /** Smoothing time accumulated while the proxy is updated at reduced smoothing LOD. */
+    float SmoothingLODAccumulatedTime;
+
     /** Values used for visualization and debugging of simulated net corrections */
 #if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
     FVector LastSmoothLocation_Debug;
@@ -177,8 +279,8 @@ public:
     float   SimulatedDebugDrawTime_Debug;
 #endif
 
-    /** Array of replay samples that we use to interpolate between to get smooth location/rotation/velocity/ect */
-    TArray< FVPCReplaySample > ReplaySamples;
+    /** Ring buffer of replay samples that we use to interpolate between to get smooth location/rotation/velocity/ect */
+    FVPCReplaySampleBuffer ReplaySamples;
 };
 
 class STEERINGSYSTEMPLUGIN_API FNetworkPredictionData_Server_VPC : public FNetworkPredictionData_Server, protected FNoncopyable
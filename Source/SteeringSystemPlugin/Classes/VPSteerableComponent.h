@@ -36,6 +36,7 @@
 #include "VPSteerableComponent.generated.h"
 
 class AVPawn;
+class UControlInputComponent;
 class UVPMovementComponent;
 
 /** 
@@ -98,6 +99,10 @@ public:
 	virtual void OnRegister() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 //END ActorComponent Interface 
+
+//BEGIN UObject Interface
+	virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
+//END UObject Interface
     
 //BEGIN Steerable Interface
 
@@ -175,6 +180,15 @@ public:
 	UFUNCTION(BlueprintCallable, Category=SteeringBehavior, meta=(DisplayName="GetMinControlInput"))
 	float K2_GetMinControlInput() const;
 
+// ~ Simulated Proxy Functions
+
+    /**
+     * Drive simulated proxy owner towards the specified velocity. Used to reconstruct member movement from replicated formation state.
+     * The velocity is applied as control input, through the owner's control input component if there is one,
+     * otherwise through the movement component pawn input. Does nothing if the owner is not a simulated proxy.
+     */
+	void SetSimulatedVelocity(const FVector& InVelocity);
+
 // ~ Direct Functions
 
 	FORCEINLINE virtual void SetFormation(FSteeringFormation* InFormation, bool bSetAsPrimary=false);
@@ -188,6 +202,7 @@ public:
 	FORCEINLINE virtual void ClearSteeringBehaviors();
 
 	FORCEINLINE virtual FTickFunction* GetSteerableTickFunction();
+	FORCEINLINE virtual UObject* GetSteerableObject();
 	FORCEINLINE virtual FString GetSteerableName() const;
 	FORCEINLINE virtual FVector GetSteerableLocation() const;
 	FORCEINLINE virtual FQuat GetSteerableOrientation() const;
@@ -216,6 +231,10 @@ protected:
 	UPROPERTY(Transient, DuplicateTransient)
 	AVPawn* PawnOwner;
 
+	/** Owner control input component, receives simulated proxy input if available. @see SetSimulatedVelocity() */
+	UPROPERTY(Transient, DuplicateTransient)
+	UControlInputComponent* ControlInputComponent;
+
 	FORCEINLINE void ResetRegisteredBehavior(FPSSteeringBehavior& Behavior);
 
     void UpdateBehavior(float DeltaTime);
@@ -34,6 +34,7 @@
 #include "UObject/CoreNet.h"
 #include "Engine/EngineTypes.h"
 #include "GameFramework/Actor.h"
+#include "VConcurrentInput.h"
 #include "VPawn.generated.h"
 
 class AController;
@@ -221,6 +222,12 @@ protected:
     UPROPERTY(Transient)
     FVector LastControlInputVector;
 
+    /**
+     * Movement input accumulated from any thread, merged into ControlInputVector when consumed.
+     * @see AddMovementInput_Concurrent()
+     */
+    FVConcurrentInputAccumulator ConcurrentControlInput;
+
 public:
 
     /**
@@ -229,6 +236,12 @@ public:
      */
     void Internal_AddMovementInput(FVector WorldAccel, bool bForce = false);
 
+    /**
+     * Thread-safe version of AddMovementInput(), may be called from worker threads evaluating steering.
+     * Input is merged into the pending input vector when consumed, independent of producer order.
+     */
+    void AddMovementInput_Concurrent(const FVector& WorldAccel, bool bForce = false);
+
     /**
      * Internal function meant for use only within VPawn or by a VPMovementComponent.
      * Marks whether current movement input is enabled.
@@ -250,7 +263,7 @@ public:
     /** Internal function meant for use only within VPawn or by a VPMovementComponent. Returns the value of ControlInputVector. */
     inline FVector Internal_GetPendingMovementInputVector() const
     {
-        return ControlInputVector;
+        return ControlInputVector + ConcurrentControlInput.Peek();
     }
 
     /** Internal function meant for use only within VPawn or by a VPMovementComponent. Returns the value of LastControlInputVector. */
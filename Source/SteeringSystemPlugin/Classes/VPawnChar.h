@@ -39,6 +39,7 @@
 #include "UObject/ObjectMacros.h"
 #include "UObject/UObjectGlobals.h"
 #include "UObject/CoreNet.h"
+#include "VCompactRepMovement.h"
 #include "VPawnChar.generated.h"
 
 // Forward declarations
@@ -175,6 +176,20 @@ protected:
 	UPROPERTY()
 	bool bInBaseReplication;
 
+	/** Whether to replicate movement to simulated proxies using ReplicatedCompactMovement instead of ReplicatedMovement. */
+	UPROPERTY(Category=Replication, EditDefaultsOnly, AdvancedDisplay)
+	bool bUseCompactReplicatedMovement;
+
+	/** Compact quantized version of ReplicatedMovement. Only replicated if bUseCompactReplicatedMovement is set. */
+	UPROPERTY(Category=Replication, EditDefaultsOnly, AdvancedDisplay, ReplicatedUsing=OnRep_ReplicatedCompactMovement)
+	FVCompactRepMovement ReplicatedCompactMovement;
+
+public:
+
+	/** Rep notify for ReplicatedCompactMovement */
+	UFUNCTION()
+	virtual void OnRep_ReplicatedCompactMovement();
+
 public:	
 
 	/** Accessor for ReplicatedServerLastTransformUpdateTimeStamp. */
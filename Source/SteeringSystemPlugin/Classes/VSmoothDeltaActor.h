@@ -34,11 +34,41 @@
 #include "UObject/CoreNet.h"
 #include "Engine/EngineTypes.h"
 #include "GameFramework/Actor.h"
+#include "VCompactRepMovement.h"
 #include "VSmoothDeltaActor.generated.h"
 
 class UVSmoothDeltaMovementComponent;
 class UArrowComponent;
 
+/**
+ * Simulation time synchronization for deterministic replication.
+ * Simulation time is reconstructed from the synchronized server clock, so this only changes when the server simulation deviates.
+ */
+USTRUCT()
+struct STEERINGSYSTEMPLUGIN_API FVSmoothDeltaSimulationSync
+{
+    GENERATED_BODY()
+
+    /** Server clock time at which simulation time was zero. */
+    UPROPERTY()
+    float StartTime;
+
+    /** Incremented on each correction so corrections with an unchanged start time are still replicated. Zero is invalid. */
+    UPROPERTY()
+    uint8 Revision;
+
+    FVSmoothDeltaSimulationSync()
+        : StartTime(0.f)
+        , Revision(0)
+    {
+    }
+
+    FORCEINLINE bool IsValid() const
+    {
+        return Revision != 0;
+    }
+};
+
 /** 
  *
  */
@@ -88,6 +118,30 @@ protected:
     UPROPERTY(ReplicatedUsing=OnRep_ReplicatedMovementSource)
     UPrimitiveComponent* ReplicatedMovementSource;
 
+    /** Whether to replicate movement to simulated proxies using ReplicatedCompactMovement instead of ReplicatedMovement. */
+    UPROPERTY(Category=Replication, EditDefaultsOnly, AdvancedDisplay)
+    bool bUseCompactReplicatedMovement;
+
+    /** Compact quantized version of ReplicatedMovement. Only replicated if bReplicateMovement and bUseCompactReplicatedMovement are set. */
+    UPROPERTY(Category=Replication, EditDefaultsOnly, AdvancedDisplay, ReplicatedUsing=OnRep_ReplicatedCompactMovement)
+    FVCompactRepMovement ReplicatedCompactMovement;
+
+    /**
+     * Whether to replicate simulation using deterministic replication.
+     * Simulated proxies reconstruct simulation time from the synchronized server clock after the initial movement source and start time handshake.
+     * Simulation time, update time stamp and movement are no longer replicated, the server only sends a correction when its simulation deviates.
+     */
+    UPROPERTY(Category=Replication, EditDefaultsOnly, AdvancedDisplay)
+    bool bUseDeterministicReplication;
+
+    /** Simulation time deviation from the synchronized server clock in seconds before a correction is sent. */
+    UPROPERTY(Category=Replication, EditDefaultsOnly, AdvancedDisplay, meta=(ClampMin="0", UIMin="0", EditCondition="bUseDeterministicReplication"))
+    float DeterministicCorrectionTolerance;
+
+    /** Simulation time synchronization. Only replicated if bUseDeterministicReplication is set. */
+    UPROPERTY(ReplicatedUsing=OnRep_ReplicatedSimulationSync)
+    FVSmoothDeltaSimulationSync ReplicatedSimulationSync;
+
 public:
 
     /** Name of the ShapeComponent. Use this name if you want to use a different class (with ObjectInitializer.SetDefaultSubobjectClass) */
@@ -113,6 +167,30 @@ public:
         return ReplicatedSimulationTime;
     }
 
+    /** Whether simulation is replicated using deterministic replication. */
+    FORCEINLINE bool IsUsingDeterministicReplication() const
+    {
+        return bUseDeterministicReplication;
+    }
+
+    /** Whether simulation time synchronization has been initialized. */
+    FORCEINLINE bool HasSimulationSync() const
+    {
+        return ReplicatedSimulationSync.IsValid();
+    }
+
+    /** Returns server world time, synchronized on clients. */
+    float GetServerClockTime() const;
+
+    /** Returns simulation time reconstructed from the synchronized server clock. */
+    float GetSynchronizedSimulationTime(float SimulationDuration) const;
+
+    /**
+     * Update simulation time synchronization with the current server simulation time.
+     * Sends a correction if the simulation has deviated from synchronized simulation time. Only used on the server.
+     */
+    void UpdateSimulationSync(float SimulationTime, float SimulationDuration);
+
     /** Accessor for MovementSource. */
     FORCEINLINE UPrimitiveComponent* GetMovementSource() const
     {
@@ -153,6 +231,14 @@ public:
     UFUNCTION()
     virtual void OnRep_ReplicatedMovementSource();
 
+    /** Rep notify for ReplicatedCompactMovement */
+    UFUNCTION()
+    virtual void OnRep_ReplicatedCompactMovement();
+
+    /** Rep notify for ReplicatedSimulationSync */
+    UFUNCTION()
+    virtual void OnRep_ReplicatedSimulationSync();
+
     /**
      * Called on client after position update is received to respond to the new location and rotation.
      * Actual change in location is expected to occur in SDMovement->SmoothCorrection(), after which this occurs.
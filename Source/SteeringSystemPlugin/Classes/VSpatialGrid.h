@@ -0,0 +1,99 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+// 
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FConvexVolume;
+
+/**
+ * Uniform grid spatial index over the XY plane.
+ *
+ * Items are identified by caller provided indices and binned by their bounds center.
+ * Each cell keeps the union of its item bounds so items larger than a cell are still found by volume queries.
+ * Items can be updated individually, cell bounds grow while items move within a cell and are recomputed
+ * when an item leaves it. Empty cells are released.
+ */
+class STEERINGSYSTEMPLUGIN_API FVSpatialGrid
+{
+public:
+
+    FVSpatialGrid(float InCellSize = 1000.f);
+
+    /** Set cell size, resets the grid and returns true if the cell size changes */
+    bool SetCellSize(float InCellSize);
+
+    /** Remove all items and cells */
+    void Reset();
+
+    /** Add item or move it to the cell of its new bounds */
+    void Update(int32 Item, const FBox& Bounds);
+
+    void Remove(int32 Item);
+
+    /** Gather items of all cells intersecting the specified volume. Items are not tested individually. */
+    void Query(const FConvexVolume& Volume, TArray<int32>& OutItems) const;
+
+    FORCEINLINE float GetCellSize() const
+    {
+        return CellSize;
+    }
+
+private:
+
+    struct FCell
+    {
+        FCell()
+            : Bounds(ForceInit)
+        {
+        }
+
+        FBox Bounds;
+        TArray<int32> Items;
+    };
+
+    struct FItem
+    {
+        FIntPoint CellId;
+        FBox Bounds;
+    };
+
+    FORCEINLINE FIntPoint GetCellId(const FBox& Bounds) const
+    {
+        const FVector Center(Bounds.GetCenter());
+        return FIntPoint(FMath::FloorToInt(Center.X * InvCellSize), FMath::FloorToInt(Center.Y * InvCellSize));
+    }
+
+    /** Remove item from its cell, recomputes the cell bounds or releases the cell if empty */
+    void RemoveFromCell(int32 Item, const FIntPoint& CellId);
+
+    TMap<FIntPoint, FCell> Cells;
+    TMap<int32, FItem> Items;
+    float CellSize;
+    float InvCellSize;
+};
@@ -0,0 +1,100 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+// 
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class USplineComponent;
+class USplineFollowingMovementComponent;
+
+/**
+ * Group of spline followers sharing a single spline source.
+ * Target transforms of all followers are evaluated in bulk once per frame,
+ * before the first follower of the group performs its movement update.
+ */
+class STEERINGSYSTEMPLUGIN_API FVSplineFollowerGroup
+{
+public:
+
+    FVSplineFollowerGroup(const USplineComponent* InSpline);
+
+    void AddFollower(USplineFollowingMovementComponent* Follower);
+    void RemoveFollower(USplineFollowingMovementComponent* Follower);
+
+    /** Evaluate target transforms of all followers, does nothing if already evaluated in the current frame */
+    void Evaluate();
+
+    /**
+     * Get bulk evaluated follower target transform.
+     * Returns false if the group has not been evaluated in the current frame or the follower spline time differs from the predicted one beyond tolerance.
+     */
+    bool GetTransform(const USplineFollowingMovementComponent* Follower, float SplineTime, FVector& OutLocation, FQuat& OutRotation) const;
+
+    FORCEINLINE int32 Num() const
+    {
+        return Followers.Num();
+    }
+
+    FORCEINLINE const USplineComponent* GetSpline() const
+    {
+        return Spline.Get();
+    }
+
+private:
+
+    TWeakObjectPtr<const USplineComponent> Spline;
+    TArray<USplineFollowingMovementComponent*> Followers;
+
+    // Evaluation data, indexed by follower batch index
+    TArray<float> SplineTimes;
+    TArray<FVector> Locations;
+    TArray<FQuat> Rotations;
+
+    uint64 EvaluatedFrame;
+    bool bHasEvaluatedTransforms;
+};
+
+typedef TSharedPtr<FVSplineFollowerGroup> FPSSplineFollowerGroup;
+
+/**
+ * Registry of spline follower groups keyed by spline source.
+ */
+class STEERINGSYSTEMPLUGIN_API FVSplineFollowerBatch
+{
+public:
+
+    /** Add follower to the group of the specified spline, create group if required */
+    static FPSSplineFollowerGroup Register(USplineFollowingMovementComponent* Follower, const USplineComponent* Spline);
+
+    /** Remove follower from group, group is released once empty */
+    static void Unregister(USplineFollowingMovementComponent* Follower, FPSSplineFollowerGroup& Group);
+
+private:
+
+    static TMap<const USplineComponent*, FPSSplineFollowerGroup> Groups;
+};
@@ -0,0 +1,71 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+// 
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/SharedPointer.h"
+#include "Containers/List.h"
+
+/**
+ * Steering memory accounting helpers.
+ *
+ * Sizes are approximations of heap usage: behavior objects report their own size through
+ * ISteeringBehaviorBase::GetAllocatedSize(), shared pointer control blocks and list nodes are added here.
+ * Use p.VSteeringMemory to dump per-category totals and per-unit averages of live steering objects.
+ */
+class STEERINGSYSTEMPLUGIN_API FVSteeringMemory
+{
+public:
+
+    /** Approximate heap size of a shared pointer reference controller */
+    static constexpr SIZE_T SharedReferenceSize = sizeof(SharedPointerInternals::FReferenceControllerBase);
+
+    /** Size of a shared object and its reference controller, zero if the pointer is invalid */
+    template<typename ObjectType>
+    static SIZE_T GetSharedAllocatedSize(const TSharedPtr<ObjectType>& Object)
+    {
+        return Object.IsValid() ? (Object->GetAllocatedSize() + SharedReferenceSize) : 0;
+    }
+
+    /** Size of behavior list nodes, behavior objects and their reference controllers */
+    template<typename BehaviorType>
+    static SIZE_T GetBehaviorListSize(const TDoubleLinkedList<TSharedPtr<BehaviorType>>& Behaviors)
+    {
+        SIZE_T AllocatedSize = Behaviors.Num() * sizeof(typename TDoubleLinkedList<TSharedPtr<BehaviorType>>::TDoubleLinkedListNode);
+
+        for (const TSharedPtr<BehaviorType>& Behavior : Behaviors)
+        {
+            AllocatedSize += GetSharedAllocatedSize(Behavior);
+        }
+
+        return AllocatedSize;
+    }
+
+    /** Log steering object memory totals and per-unit averages of all live steering components */
+    static void Dump();
+};
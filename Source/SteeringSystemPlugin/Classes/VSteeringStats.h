@@ -0,0 +1,72 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+// 
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "SteeringSystemPlugin.h"
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Behavior Allocations"), STAT_VBehaviorAllocations, STATGROUP_Steering, STEERINGSYSTEMPLUGIN_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Formation Pattern Updates"), STAT_VFormationPatternUpdates, STATGROUP_Steering, STEERINGSYSTEMPLUGIN_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Formation Slot Reassignments"), STAT_VFormationSlotReassignments, STATGROUP_Steering, STEERINGSYSTEMPLUGIN_API);
+
+#if STATS
+
+/**
+ * Steering behavior stats created on demand per behavior type.
+ * Behavior types are reported as a cycle stat and a call count stat in STATGROUP_Steering.
+ */
+class STEERINGSYSTEMPLUGIN_API FVSteeringStats
+{
+public:
+
+    struct FBehaviorStats
+    {
+        TStatId CycleStat;
+        TStatId CallStat;
+    };
+
+    /** Find or create stats of the specified behavior type. Game thread only. */
+    static FBehaviorStats GetBehaviorStats(FName BehaviorType);
+
+private:
+
+    static TMap<FName, FBehaviorStats> BehaviorStats;
+};
+
+/** Count behavior evaluation and measure its cycles for the rest of the scope, stats are cached on the behavior */
+#define SCOPE_STEERING_BEHAVIOR_STAT(Behavior) \
+    const FVSteeringStats::FBehaviorStats& SteeringBehaviorStats((Behavior)->GetBehaviorStats()); \
+    INC_DWORD_STAT_FName(SteeringBehaviorStats.CallStat.GetName()); \
+    FScopeCycleCounter SteeringBehaviorCycleCounter(SteeringBehaviorStats.CycleStat);
+
+#else
+
+#define SCOPE_STEERING_BEHAVIOR_STAT(Behavior)
+
+#endif
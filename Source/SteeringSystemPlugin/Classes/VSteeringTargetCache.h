@@ -0,0 +1,77 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+// 
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+
+class USceneComponent;
+
+/**
+ * Shared transform cache of component steering targets.
+ *
+ * Components are tracked when a steering target is set to them. Tracked transforms are resolved once per frame
+ * on the game thread before actors tick, all behaviors chasing the same component read the same resolved transform.
+ * Reads do not modify the cache and are safe from worker threads while the game thread is not resolving or tracking.
+ * Entries are removed once their component is destroyed.
+ */
+class STEERINGSYSTEMPLUGIN_API FVSteeringTargetCache
+{
+public:
+
+    struct FEntry
+    {
+        FVector Location;
+        FQuat Rotation;
+    };
+
+    /** Track component transform, resolved immediately and then once per frame. Game thread only. */
+    static void Track(USceneComponent* Component);
+
+    /** Resolve tracked component transforms and remove entries of destroyed components. Game thread only. */
+    static void Resolve();
+
+    /** Resolved entry of a tracked component, null if the component is not tracked */
+    FORCEINLINE static const FEntry* Find(const TWeakObjectPtr<USceneComponent>& Component)
+    {
+        return Entries.Find(Component);
+    }
+
+    /** Number of cached component entries */
+    static int32 Num();
+
+    /** Returns total memory allocated by cache entries. */
+    static SIZE_T GetAllocatedSize();
+
+    static void Clear();
+
+private:
+
+    static TMap<TWeakObjectPtr<USceneComponent>, FEntry> Entries;
+    static uint64 ResolvedFrame;
+};
@@ -0,0 +1,109 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+// 
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#ifndef STEERING_TRACE_ENABLED
+#define STEERING_TRACE_ENABLED !UE_BUILD_SHIPPING
+#endif
+
+enum class EVSteeringTraceEvent : uint8
+{
+    BehaviorActivated,
+    BehaviorDeactivated,
+    BehaviorDone,
+    ControlInput,
+    FormationMemberAdded,
+    FormationMemberRemoved,
+    FormationPatternRebuild,
+    FormationSlotReassignment
+};
+
+/**
+ * Compact steering trace event.
+ * Source is the unique id of the owning object, or the pointer hash of non-UObject sources such as formations.
+ */
+struct FVSteeringTraceEvent
+{
+    uint32 Frame;
+    uint32 Source;
+    FName Name;
+    float Value;
+    EVSteeringTraceEvent Type;
+};
+
+/**
+ * Steering event trace.
+ *
+ * Records steering decisions and formation lifecycle events into a fixed capacity ring buffer while p.VSteeringTrace is enabled.
+ * Recorded events are written as CSV to the profiling directory with p.VSteeringTrace.Dump.
+ * Events are expected to be recorded on the game thread.
+ *
+ * Event values:
+ * - BehaviorActivated, BehaviorDeactivated, BehaviorDone: unused, name is the behavior type
+ * - ControlInput: control input magnitude, name is the behavior type
+ * - FormationMemberAdded, FormationMemberRemoved: member count, name is the member name
+ * - FormationPatternRebuild: member count
+ * - FormationSlotReassignment: total distance between members and their newly assigned slots
+ */
+class STEERINGSYSTEMPLUGIN_API FVSteeringTrace
+{
+public:
+
+    static bool IsEnabled();
+
+    static void Record(EVSteeringTraceEvent Type, uint32 Source, FName Name, float Value);
+
+    /** Write recorded events in chronological order, returns false if the file could not be written */
+    static bool Dump(const FString& Filename);
+
+    static void Reset();
+
+    static const TCHAR* GetEventName(EVSteeringTraceEvent Type);
+
+private:
+
+    static TArray<FVSteeringTraceEvent> Events;
+    static int32 Capacity;
+    static int32 Head;
+};
+
+#if STEERING_TRACE_ENABLED
+#define STEERING_TRACE(EventType, Source, Name, Value) \
+    do \
+    { \
+        if (FVSteeringTrace::IsEnabled()) \
+        { \
+            FVSteeringTrace::Record(EVSteeringTraceEvent::EventType, Source, Name, Value); \
+        } \
+    } \
+    while (0)
+#else
+#define STEERING_TRACE(EventType, Source, Name, Value)
+#endif
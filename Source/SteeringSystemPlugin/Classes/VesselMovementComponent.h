@@ -30,10 +30,16 @@
 #include "CoreMinimal.h"
 #include "UObject/ObjectMacros.h"
 #include "GameFramework/MovementComponent.h"
+#include "VFixedTimeStep.h"
+#include "VMovementKernel.h"
+#include "VCurveLUT.h"
+#include "VAvoidanceSchedule.h"
+#include "VOrcaSolver.h"
 #include "VesselMovementComponent.generated.h"
 
 class UControlInputComponent;
 class URVO3DAgentComponent;
+class UCurveFloat;
 
 UCLASS(ClassGroup=Movement, meta=(BlueprintSpawnableComponent))
 class STEERINGSYSTEMPLUGIN_API UVesselMovementComponent : public UMovementComponent
@@ -46,10 +52,18 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=Component)
     bool bAutoRegisterControlComponent;
 
-    /** If true, search for the owner's RVO agent component as the RVOAgentComponent if there is not one currently assigned. */
+    /** If true, search for the owner's RVO agent component as the RVOAgentComponent if there is not one currently assigned. Ignored with built-in avoidance. */
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=Component)
     bool bAutoRegisterRVOAgentComponent;
 
+    /** If true, avoidance is solved by the plugin built-in ORCA solver instead of the RVO agent component. */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=Avoidance)
+    bool bUseBuiltInAvoidance;
+
+    /** Built-in ORCA avoidance agent settings. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Avoidance, meta=(EditCondition="bUseBuiltInAvoidance"))
+    FVOrcaAgentSettings BuiltInAvoidanceSettings;
+
     /** Maximum velocity magnitude allowed for the controlled Pawn. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=LinearMovement)
     float MaxSpeed;
@@ -62,6 +76,55 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=LinearMovement)
     float Deceleration;
 
+    /**
+     * If true, velocity is integrated with vessel dynamics instead of being set along the vessel orientation.
+     * Velocity not aligned with the vessel forward direction is kept as lateral drift and dampened by lateral drag,
+     * turning bleeds forward speed and vessels coast under drag without control input.
+     * @see ForwardDrag, LateralDrag, TurnSpeedLoss, ThrustCurve, DragCurve
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=VesselDynamics)
+    bool bUseVesselDynamics;
+
+    /** Forward drag coefficient, proportional forward speed loss per second. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=VesselDynamics, meta=(ClampMin="0", UIMin="0", EditCondition="bUseVesselDynamics"))
+    float ForwardDrag;
+
+    /** Lateral drag coefficient, proportional lateral drift speed loss per second. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=VesselDynamics, meta=(ClampMin="0", UIMin="0", EditCondition="bUseVesselDynamics"))
+    float LateralDrag;
+
+    /** Fraction of forward speed lost per radian turned. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=VesselDynamics, meta=(ClampMin="0", UIMin="0", EditCondition="bUseVesselDynamics"))
+    float TurnSpeedLoss;
+
+    /** Acceleration scale over forward speed ratio (forward speed / max speed) within [0..1]. Constant 1 if not set. */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=VesselDynamics, meta=(EditCondition="bUseVesselDynamics"))
+    UCurveFloat* ThrustCurve;
+
+    /** Forward drag scale over forward speed ratio (forward speed / max speed) within [0..1]. Constant 1 if not set. */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=VesselDynamics, meta=(EditCondition="bUseVesselDynamics"))
+    UCurveFloat* DragCurve;
+
+    /** Number of samples of thrust and drag curve lookup tables. */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=VesselDynamics, AdvancedDisplay, meta=(ClampMin="2", UIMin="2", EditCondition="bUseVesselDynamics"))
+    int32 DynamicsCurveSampleCount;
+
+    /**
+     * If true, movement is performed in fixed time steps instead of variable frame delta time.
+     * Keeps per-step collision cost bounded on hitches and makes movement reproducible.
+     * @see FixedTimeStep, MaxFixedTimeSteps, SetInterpolatedComponent()
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=FixedTimeStep)
+    bool bUseFixedTimeStep;
+
+    /** Simulation step time in seconds used by fixed time step movement. */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=FixedTimeStep, meta=(ClampMin="0.001", UIMin="0.001", EditCondition="bUseFixedTimeStep"))
+    float FixedTimeStep;
+
+    /** Maximum number of fixed steps performed in a single frame. Accumulated time over this limit is discarded. */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=FixedTimeStep, meta=(ClampMin="1", UIMin="1", EditCondition="bUseFixedTimeStep"))
+    int32 MaxFixedTimeSteps;
+
 private:
 
     /**
@@ -103,19 +166,40 @@ public:
     UFUNCTION(BlueprintCallable, Category=VesselMovementComponent)
     void SetTurnAcceleration(float InTurnAcceleration);
 
+    /** Rebuild thrust and drag curve lookup tables. Call after modifying dynamics curves at runtime. */
+    UFUNCTION(BlueprintCallable, Category=VesselMovementComponent)
+    void RefreshVesselDynamics();
+
     UFUNCTION(BlueprintCallable, Category=VesselMovementComponent)
     virtual void SetControlInputComponent(UControlInputComponent* InControlInputComponent);
 
     UFUNCTION(BlueprintCallable, Category=VesselMovementComponent)
     virtual void SetRVOAgentComponent(URVO3DAgentComponent* InRVOAgentComponent);
 
+    /**
+     * Assign visual component interpolated between fixed time steps. Must be attached to the updated component.
+     * Its current relative transform is used as the base transform.
+     */
+    UFUNCTION(BlueprintCallable, Category=VesselMovementComponent)
+    virtual void SetInterpolatedComponent(USceneComponent* InInterpolatedComponent);
+
 //BEGIN UActorComponent Interface
     virtual void InitializeComponent() override;
     virtual void OnRegister() override;
+    virtual void OnUnregister() override;
     virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction) override;
 //END UActorComponent Interface
 
+//BEGIN UObject Interface
+    virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
+#if WITH_EDITOR
+    virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif // WITH_EDITOR
+//END UObject Interface
+
 //BEGIN UMovementComponent Interface
+    virtual void SetUpdatedComponent(USceneComponent* NewUpdatedComponent) override;
+
     virtual float GetMaxSpeed() const override
     {
         return MaxSpeed;
@@ -152,30 +236,60 @@ protected:
     UPROPERTY(Transient)
     bool bWasAvoidanceUpdated;
 
+    /** Adaptive avoidance evaluation schedule */
+    FVAvoidanceSchedule AvoidanceSchedule;
+
+    /**
+     * Visual component interpolated between fixed time steps.
+     * @see bUseFixedTimeStep, SetInterpolatedComponent()
+     */
+    UPROPERTY(BlueprintReadOnly, Transient, DuplicateTransient, Category=MovementComponent)
+    USceneComponent* InterpolatedComponent;
+
+    /** Interpolated component base relative transform */
+    FVector InterpolatedBaseLocation;
+    FQuat InterpolatedBaseRotation;
+
+    /** Fixed time step accumulator and interpolation state */
+    FVFixedTimeStep FixedTimeStepState;
+
+    /** Apply control input and move updated component */
+    virtual void PerformMovement(float DeltaTime);
+
+    /** Perform movement in fixed time steps and interpolate visual component between steps */
+    virtual void PerformFixedTimeStepMovement(float DeltaTime);
+
     /** Update Velocity based on input */
     virtual void ApplyControlInputToVelocity(float DeltaTime);
 
     /** Decelerate current velocity */
     virtual void Decelerate(float DeltaTime);
 
+    /** Update velocity and orientation from control input using vessel dynamics */
+    virtual void ApplyVesselDynamics(float DeltaTime, const FVector& ControlInput, bool bEnableAcceleration);
+
     /** calculate RVO avoidance and apply it to current velocity */
     virtual void CalcAvoidanceVelocity();
 
+    /** Get avoidance velocity from the active avoidance solver. Returns false if there is no avoidance override. */
+    bool GetAvoidanceVelocity(FVector& OutVelocity) const;
+
 private:
 
-    // Turn range properties
-    bool bUseTurnRange;
-    float CurrentTurnRate;
-    float TurnInterpRangeInv;
-    FVector LastTurnDelta;
+    // Built-in avoidance solver agent
+    FVOrcaAgentHandle AvoidanceAgent;
+
+    // Turn range and velocity integration
+    FVMovementKernel MovementKernel;
+
+    // Baked vessel dynamics curves
+    FVCurveLUT ThrustLUT;
+    FVCurveLUT DragLUT;
 
     // Velocity orientation, implicitly updated component orientation
     FQuat VelocityOrientation;
 
     void RefreshTurnRange();
-    void PrepareTurnRange(float DeltaTime, const FVector& VelocityNormal, const FVector& InputNormal);
-    void ClearTurnRange();
-    void InterpOrientation(FQuat& Orientation, const FVector& Current, const FVector& Target, float DeltaTime, float RotationSpeedDegrees);
 
     FORCEINLINE FVector GetControlInput() const;
 };
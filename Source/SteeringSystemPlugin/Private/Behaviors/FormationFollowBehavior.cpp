@@ -60,7 +60,7 @@ void FFormationFollowBehavior::OnDeactivated()
 bool FFormationFollowBehavior::CalculateRegroupSteering(float DeltaTime, FSteeringAcceleration& ControlInput)
 {
     const FVector SrcLocation(Steerable->GetSteerableLocation());
-    FVector& DstLocation(RegroupBehavior.SteeringTarget.Location);
+    FVector DstLocation(RegroupBehavior.SteeringTarget.GetLocation());
 
     CalculateCurrentSlotLocation(DstLocation);
 
@@ -88,6 +88,8 @@ bool FFormationFollowBehavior::CalculateRegroupSteering(float DeltaTime, FSteeri
         }
     }
 
+    RegroupBehavior.SteeringTarget.SetLocation(DstLocation);
+
     bool bRegrouped = RegroupBehavior.CalculateSteering(DeltaTime, ControlInput);
 
     if (! bRegrouped && bLimitVelocity)
@@ -116,10 +118,11 @@ bool FFormationFollowBehavior::CalculateSteeringImpl(float DeltaTime, FSteeringA
 
     // Assign checkpoint target location
     {
-        FVector& SlotLocation(CheckpointBehavior.SteeringTarget.Location);
+        FVector SlotLocation(CheckpointBehavior.SteeringTarget.GetLocation());
 
         ReachTime = CalculateCheckpoint(SlotLocation);
         CalculateVelocityLimit(SlotLocation, ReachTime, VelocityLimit);
+        CheckpointBehavior.SteeringTarget.SetLocation(SlotLocation);
     }
     bool bCheckpointPassed = CheckpointBehavior.CalculateSteering(DeltaTime, ControlInput);
 
@@ -132,8 +135,9 @@ bool FFormationFollowBehavior::CalculateSteeringImpl(float DeltaTime, FSteeringA
 
     // Assign arrival target location
     {
-        FVector& SlotLocation(ArriveBehavior.SteeringTarget.Location);
+        FVector SlotLocation(ArriveBehavior.SteeringTarget.GetLocation());
         Formation.CalculateSlotLocation(Steerable, SlotLocation, SteeringTarget.GetLocation());
+        ArriveBehavior.SteeringTarget.SetLocation(SlotLocation);
     }
 
     bool bArrived = ArriveBehavior.CalculateSteering(DeltaTime, ControlInput);
@@ -144,8 +148,9 @@ bool FFormationFollowBehavior::CalculateSteeringImpl(float DeltaTime, FSteeringA
 
     if (bArrived)
     {
-        FQuat& SlotOrientation(AlignBehavior.SteeringTarget.Rotation);
+        FQuat SlotOrientation(AlignBehavior.SteeringTarget.GetRotation());
         Formation.CalculateSlotOrientation(Steerable, SlotOrientation);
+        AlignBehavior.SteeringTarget.SetRotation(SlotOrientation);
 
         bAligned = AlignBehavior.CalculateSteering(DeltaTime, ControlInput);
     }
@@ -234,7 +234,7 @@ void FMoveFormationBehavior::UpdateAnchorMovement(float DeltaTime)
     FSteeringFormation& Formation(GetFormation());
 
     const FVector SrcLocation = Formation.GetAnchorLocation();
-    const FVector& DstLocation(SteeringTarget.Location);
+    const FVector DstLocation(SteeringTarget.GetLocation());
     const FVector DeltaLocation = DstLocation-SrcLocation;
 
     const float DeltaDistSq = DeltaLocation.SizeSquared();
@@ -302,7 +302,7 @@ void FMoveFormationBehavior::UpdateFormationOrientation()
 
     FSteeringFormation& Formation(GetFormation());
     const FVector AnchorLocation(Formation.GetAnchorLocation());
-    const FVector TargetDirection = (SteeringTarget.Location-AnchorLocation).GetSafeNormal();
+    const FVector TargetDirection = (SteeringTarget.GetLocation()-AnchorLocation).GetSafeNormal();
 
     Formation.SetOrientation(TargetDirection.ToOrientationQuat());
 }
@@ -77,6 +77,14 @@ void UControlInputComponent::AddInputVector_Direct(FVector WorldAccel, bool bFor
 	}
 }
 
+void UControlInputComponent::AddInputVector_Concurrent(const FVector& WorldAccel, bool bForce /*=false*/)
+{
+	if (bForce || ! IsMoveInputIgnored_Direct())
+	{
+		ConcurrentControlInput.Add(WorldAccel);
+	}
+}
+
 void UControlInputComponent::SetEnableAcceleration_Direct(bool bInEnableAcceleration)
 {
     bEnableAcceleration = bInEnableAcceleration;
@@ -84,7 +92,7 @@ void UControlInputComponent::SetEnableAcceleration_Direct(bool bInEnableAccelera
 
 FVector UControlInputComponent::GetPendingInputVector_Direct() const
 {
-	return ControlInputVector;
+	return ControlInputVector + ConcurrentControlInput.Peek();
 }
 
 FVector UControlInputComponent::GetLastInputVector_Direct() const
@@ -94,7 +102,7 @@ FVector UControlInputComponent::GetLastInputVector_Direct() const
 
 FVector UControlInputComponent::ConsumeInputVector_Direct()
 {
-	LastControlInputVector = ControlInputVector;
+	LastControlInputVector = ControlInputVector + ConcurrentControlInput.Consume();
 	ControlInputVector = FVector::ZeroVector;
     bEnableAcceleration = true;
 	return LastControlInputVector;
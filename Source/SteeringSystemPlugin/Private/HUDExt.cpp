@@ -26,9 +26,175 @@
 // 
 
 #include "HUDExt.h"
+#include "Engine/Canvas.h"
+#include "SceneView.h"
+#include "ConvexVolume.h"
 
-void AHUDExt::FindFilteredActorsInSelectionRectangle(const TArray<USceneComponent*>& Components, const FVector2D& FirstPoint, const FVector2D& SecondPoint, TArray<AActor*>& OutActors, bool bActorMustBeFullyEnclosed)
+DECLARE_CYCLE_STAT(TEXT("HUD Selection Rectangle"), STAT_HUDExt_SelectionRectangle, STATGROUP_Steering);
+DECLARE_CYCLE_STAT(TEXT("HUD Selection Index Update"), STAT_HUDExt_SelectionIndexUpdate, STATGROUP_Steering);
+DECLARE_DWORD_COUNTER_STAT(TEXT("HUD Selection Candidates"), STAT_HUDExt_SelectionCandidates, STATGROUP_Steering);
+
+/**
+ * Batched canvas projection, matches UCanvas::Project() with the view projection matrix fetched once.
+ */
+struct FHUDExtProjection
+{
+    VectorRegister Rows[4];
+    VectorRegister ScreenScale;
+    VectorRegister ScreenOffset;
+    FVector2D HalfClip;
+    FVector2D RadiusScale;
+
+    FHUDExtProjection(const UCanvas& Canvas)
+    {
+        check(Canvas.SceneView);
+
+        const FViewMatrices& ViewMatrices(Canvas.SceneView->ViewMatrices);
+        const FMatrix& ViewProjection(ViewMatrices.GetViewProjectionMatrix());
+        const FMatrix& Projection(ViewMatrices.GetProjectionMatrix());
+
+        for (int32 i=0; i<4; ++i)
+        {
+            Rows[i] = VectorLoadAligned(ViewProjection.M[i]);
+        }
+
+        HalfClip = FVector2D(Canvas.ClipX * .5f, Canvas.ClipY * .5f);
+
+        ScreenScale = MakeVectorRegister(HalfClip.X, -GProjectionSignY * HalfClip.Y, 1.f, 1.f);
+        ScreenOffset = MakeVectorRegister(HalfClip.X, HalfClip.Y, 0.f, 0.f);
+        RadiusScale = FVector2D(Projection.M[0][0] * HalfClip.X, Projection.M[1][1] * HalfClip.Y);
+    }
+
+    /** Transform world location with W=1 into clip space */
+    FORCEINLINE VectorRegister TransformPosition(const FVector& Location) const
+    {
+        VectorRegister Result = VectorMultiplyAdd(VectorLoadFloat1(&Location.Z), Rows[2], Rows[3]);
+        Result = VectorMultiplyAdd(VectorLoadFloat1(&Location.Y), Rows[1], Result);
+        return VectorMultiplyAdd(VectorLoadFloat1(&Location.X), Rows[0], Result);
+    }
+
+    /** Transform world direction with W=0 into clip space */
+    FORCEINLINE VectorRegister TransformVector(const FVector& Direction) const
+    {
+        VectorRegister Result = VectorMultiply(VectorLoadFloat1(&Direction.Z), Rows[2]);
+        Result = VectorMultiplyAdd(VectorLoadFloat1(&Direction.Y), Rows[1], Result);
+        return VectorMultiplyAdd(VectorLoadFloat1(&Direction.X), Rows[0], Result);
+    }
+
+    /** Perspective divide clip space position and map it to canvas space */
+    FORCEINLINE VectorRegister ClipToScreen(const VectorRegister& Clip) const
+    {
+        const VectorRegister KindaSmall = VectorSetFloat1(KINDA_SMALL_NUMBER);
+        VectorRegister W = VectorReplicate(Clip, 3);
+        W = VectorSelect(VectorCompareEQ(W, VectorZero()), KindaSmall, W);
+        return VectorMultiplyAdd(VectorDivide(Clip, W), ScreenScale, ScreenOffset);
+    }
+
+    /** Project bounds box corners into a canvas space rectangle */
+    FBox2D ProjectBox(const FBoxSphereBounds& Bounds) const
+    {
+        const VectorRegister Center = TransformPosition(Bounds.Origin);
+        const VectorRegister AxisX = TransformVector(FVector(Bounds.BoxExtent.X, 0.f, 0.f));
+        const VectorRegister AxisY = TransformVector(FVector(0.f, Bounds.BoxExtent.Y, 0.f));
+        const VectorRegister AxisZ = TransformVector(FVector(0.f, 0.f, Bounds.BoxExtent.Z));
+
+        // Box corners are the clip space center offset by transformed extent axes
+        const VectorRegister EdgesX[2] = { VectorAdd(Center, AxisX), VectorSubtract(Center, AxisX) };
+        VectorRegister Edges[4];
+
+        for (int32 i=0; i<2; ++i)
+        {
+            Edges[i*2  ] = VectorAdd(EdgesX[i], AxisY);
+            Edges[i*2+1] = VectorSubtract(EdgesX[i], AxisY);
+        }
+
+        VectorRegister BoxMin = VectorSetFloat1(MAX_flt);
+        VectorRegister BoxMax = VectorSetFloat1(-MAX_flt);
+
+        for (int32 i=0; i<4; ++i)
+        {
+            const VectorRegister Upper = ClipToScreen(VectorAdd(Edges[i], AxisZ));
+            const VectorRegister Lower = ClipToScreen(VectorSubtract(Edges[i], AxisZ));
+            BoxMin = VectorMin(BoxMin, VectorMin(Upper, Lower));
+            BoxMax = VectorMax(BoxMax, VectorMax(Upper, Lower));
+        }
+
+        FVector4 Min, Max;
+        VectorStoreAligned(BoxMin, &Min);
+        VectorStoreAligned(BoxMax, &Max);
+
+        return FBox2D(FVector2D(Min.X, Min.Y), FVector2D(Max.X, Max.Y));
+    }
+
+    /** Project bounds into a canvas space rectangle, returns false if the bounds could not be projected */
+    FORCEINLINE bool Project(const FBoxSphereBounds& Bounds, bool bUseBoundsSphere, FBox2D& OutBox) const
+    {
+        if (bUseBoundsSphere)
+        {
+            return ProjectSphere(Bounds, OutBox);
+        }
+
+        OutBox = ProjectBox(Bounds);
+        return true;
+    }
+
+    /** Project bounds center and sphere radius into a canvas space rectangle, returns false if the bounds center is behind the view */
+    bool ProjectSphere(const FBoxSphereBounds& Bounds, FBox2D& OutBox) const
+    {
+        FVector4 Clip;
+        VectorStoreAligned(TransformPosition(Bounds.Origin), &Clip);
+
+        if (Clip.W <= 0.f)
+        {
+            return false;
+        }
+
+        const float RHW = 1.f / Clip.W;
+        const FVector2D ScreenCenter(
+            HalfClip.X + Clip.X*RHW*HalfClip.X,
+            HalfClip.Y - GProjectionSignY*Clip.Y*RHW*HalfClip.Y
+            );
+        const FVector2D ScreenExtent(RadiusScale * (Bounds.SphereRadius * RHW));
+
+        OutBox = FBox2D(ScreenCenter-ScreenExtent, ScreenCenter+ScreenExtent);
+
+        return true;
+    }
+};
+
+static FORCEINLINE bool IsInSelectionRectangle(const FBox2D& SelectionRectangle, const FBox2D& ActorBox2D, bool bActorMustBeFullyEnclosed)
 {
+    return bActorMustBeFullyEnclosed ? SelectionRectangle.IsInside(ActorBox2D) : SelectionRectangle.Intersect(ActorBox2D);
+}
+
+AHUDExt::AHUDExt(const FObjectInitializer& ObjectInitializer)
+    : Super(ObjectInitializer)
+    , SelectionIndexCellSize(2000.f)
+{
+}
+
+void AHUDExt::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    for (const FSelectable& Selectable : Selectables)
+    {
+        if (USceneComponent* Comp = Selectable.Component.Get())
+        {
+            Comp->TransformUpdated.Remove(Selectable.TransformUpdatedHandle);
+        }
+    }
+
+    Selectables.Reset();
+    SelectableIndices.Reset();
+    DirtySelectables.Reset();
+    SelectionIndex.Reset();
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void AHUDExt::FindFilteredActorsInSelectionRectangle(const TArray<USceneComponent*>& Components, const FVector2D& FirstPoint, const FVector2D& SecondPoint, TArray<AActor*>& OutActors, bool bActorMustBeFullyEnclosed, bool bUseBoundsSphere)
+{
+    SCOPE_CYCLE_COUNTER(STAT_HUDExt_SelectionRectangle);
+
     // Because this is a HUD function it is likely to get called each tick,
     // so make sure any previous contents of the out actor array have been cleared!
     OutActors.Reset();
@@ -41,6 +207,30 @@ void AHUDExt::FindFilteredActorsInSelectionRectangle(const TArray<USceneComponen
     SelectionRectangle += FirstPoint;
     SelectionRectangle += SecondPoint;
 
+    // Batched projection, requires canvas scene view
+    if (Canvas && Canvas->SceneView)
+    {
+        const FHUDExtProjection Projection(*Canvas);
+
+        for (USceneComponent* Comp : Components)
+        {
+            if (! IsValid(Comp) || ! Comp->GetOwner())
+            {
+                continue;
+            }
+
+            // Build 2D bounding box of actor in screen space
+            FBox2D ActorBox2D(ForceInit);
+
+            if (Projection.Project(Comp->Bounds, bUseBoundsSphere, ActorBox2D) && IsInSelectionRectangle(SelectionRectangle, ActorBox2D, bActorMustBeFullyEnclosed))
+            {
+                OutActors.Add(Comp->GetOwner());
+            }
+        }
+
+        return;
+    }
+
     //The Actor Bounds Point Mapping
     const FVector BoundsPointMapping[8] =
     {
@@ -93,9 +283,377 @@ void AHUDExt::FindFilteredActorsInSelectionRectangle(const TArray<USceneComponen
     }
 }
 
-TArray<AActor*> AHUDExt::GetFilteredActorsInSelectionRectangle(const TArray<USceneComponent*>& Components, const FVector2D& FirstPoint, const FVector2D& SecondPoint, bool bActorMustBeFullyEnclosed)
+TArray<AActor*> AHUDExt::GetFilteredActorsInSelectionRectangle(const TArray<USceneComponent*>& Components, const FVector2D& FirstPoint, const FVector2D& SecondPoint, bool bActorMustBeFullyEnclosed, bool bUseBoundsSphere)
 {
     TArray<AActor*> OutActors;
-    FindFilteredActorsInSelectionRectangle(Components, FirstPoint, SecondPoint, OutActors, bActorMustBeFullyEnclosed);
+    FindFilteredActorsInSelectionRectangle(Components, FirstPoint, SecondPoint, OutActors, bActorMustBeFullyEnclosed, bUseBoundsSphere);
     return MoveTemp(OutActors);
 }
+
+void AHUDExt::RegisterSelectable(USceneComponent* Component)
+{
+    if (! IsValid(Component) || SelectableIndices.Contains(Component))
+    {
+        return;
+    }
+
+    FSelectable Selectable;
+    Selectable.Component = Component;
+    Selectable.TransformUpdatedHandle = Component->TransformUpdated.AddUObject(this, &AHUDExt::OnSelectableTransformUpdated);
+
+    const int32 Index = Selectables.Add(Selectable);
+    SelectableIndices.Emplace(Component, Index);
+    DirtySelectables.Emplace(Index);
+}
+
+void AHUDExt::UnregisterSelectable(USceneComponent* Component)
+{
+    if (const int32* Index = SelectableIndices.Find(Component))
+    {
+        RemoveSelectable(*Index);
+    }
+}
+
+void AHUDExt::RemoveSelectable(int32 Index)
+{
+    const FSelectable& Selectable(Selectables[Index]);
+
+    if (USceneComponent* Comp = Selectable.Component.Get())
+    {
+        Comp->TransformUpdated.Remove(Selectable.TransformUpdatedHandle);
+    }
+
+    SelectableIndices.Remove(Selectable.Component);
+    DirtySelectables.Remove(Index);
+    SelectionIndex.Remove(Index);
+    Selectables.RemoveAt(Index);
+}
+
+void AHUDExt::OnSelectableTransformUpdated(USceneComponent* Component, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+    if (const int32* Index = SelectableIndices.Find(Component))
+    {
+        DirtySelectables.Emplace(*Index);
+    }
+}
+
+void AHUDExt::UpdateSelectionIndex()
+{
+    SCOPE_CYCLE_COUNTER(STAT_HUDExt_SelectionIndexUpdate);
+
+    // Cell size change resets the index, add all selectables again
+    if (SelectionIndex.SetCellSize(SelectionIndexCellSize))
+    {
+        for (TSparseArray<FSelectable>::TConstIterator It(Selectables); It; ++It)
+        {
+            DirtySelectables.Emplace(It.GetIndex());
+        }
+    }
+
+    for (int32 Index : DirtySelectables)
+    {
+        if (USceneComponent* Comp = Selectables[Index].Component.Get())
+        {
+            SelectionIndex.Update(Index, Comp->Bounds.GetBox());
+        }
+    }
+
+    DirtySelectables.Reset();
+}
+
+bool AHUDExt::GetSelectionFrustum(const FBox2D& SelectionRectangle, TArray<FPlane>& OutPlanes)
+{
+    const FVector2D Size(SelectionRectangle.GetSize());
+
+    if (! Canvas || ! Canvas->SceneView || Size.X < 1.f || Size.Y < 1.f)
+    {
+        return false;
+    }
+
+    const FVector2D Corners[4] =
+    {
+        FVector2D(SelectionRectangle.Min.X, SelectionRectangle.Min.Y),
+        FVector2D(SelectionRectangle.Max.X, SelectionRectangle.Min.Y),
+        FVector2D(SelectionRectangle.Max.X, SelectionRectangle.Max.Y),
+        FVector2D(SelectionRectangle.Min.X, SelectionRectangle.Max.Y)
+    };
+
+    FVector Origins[4];
+    FVector Directions[4];
+
+    for (int32 i=0; i<4; ++i)
+    {
+        Deproject(Corners[i].X, Corners[i].Y, Origins[i], Directions[i]);
+    }
+
+    // Point inside the frustum used to orient plane normals outwards
+    const FVector2D Center(SelectionRectangle.GetCenter());
+    FVector CenterOrigin, CenterDirection;
+    Deproject(Center.X, Center.Y, CenterOrigin, CenterDirection);
+    const FVector InsidePoint(CenterOrigin + CenterDirection * 100.f);
+
+    OutPlanes.Reset();
+
+    for (int32 i=0; i<4; ++i)
+    {
+        const int32 j = (i+1) % 4;
+        FPlane Plane(Origins[i], Origins[i]+Directions[i], Origins[j]+Directions[j]);
+
+        if (Plane.PlaneDot(InsidePoint) > 0.f)
+        {
+            Plane = Plane.Flip();
+        }
+
+        OutPlanes.Emplace(Plane);
+    }
+
+    // Discard everything behind the view
+    OutPlanes.Emplace(CenterOrigin, -CenterDirection);
+
+    return true;
+}
+
+void AHUDExt::FindSelectableActorsInSelectionRectangle(const FVector2D& FirstPoint, const FVector2D& SecondPoint, TArray<AActor*>& OutActors, bool bActorMustBeFullyEnclosed, bool bUseBoundsSphere)
+{
+    FBox2D SelectionRectangle(ForceInit);
+    SelectionRectangle += FirstPoint;
+    SelectionRectangle += SecondPoint;
+
+    SelectionCandidates.Reset();
+    GatherSelectionCandidates(SelectionRectangle);
+
+    INC_DWORD_STAT_BY(STAT_HUDExt_SelectionCandidates, SelectionCandidates.Num());
+
+    FindFilteredActorsInSelectionRectangle(SelectionCandidates, FirstPoint, SecondPoint, OutActors, bActorMustBeFullyEnclosed, bUseBoundsSphere);
+}
+
+void AHUDExt::GatherSelectionCandidates(const FBox2D& SelectionRectangle)
+{
+    UpdateSelectionIndex();
+
+    TArray<FPlane> Planes;
+
+    if (GetSelectionFrustum(SelectionRectangle, Planes))
+    {
+        const FConvexVolume SelectionFrustum(Planes);
+
+        // Cull cells then components against the selection frustum
+        SelectionQueryItems.Reset();
+        SelectionIndex.Query(SelectionFrustum, SelectionQueryItems);
+
+        for (int32 Item : SelectionQueryItems)
+        {
+            USceneComponent* Comp = Selectables[Item].Component.Get();
+
+            // Destroyed components are released when found by a query
+            if (! Comp)
+            {
+                RemoveSelectable(Item);
+                continue;
+            }
+
+            if (SelectionFrustum.IntersectBox(Comp->Bounds.Origin, Comp->Bounds.BoxExtent))
+            {
+                SelectionCandidates.Emplace(Comp);
+            }
+        }
+    }
+    else
+    {
+        // Degenerate selection rectangle or no view, test all selectables in screen space
+        for (const FSelectable& Selectable : Selectables)
+        {
+            if (USceneComponent* Comp = Selectable.Component.Get())
+            {
+                SelectionCandidates.Emplace(Comp);
+            }
+        }
+    }
+}
+
+void AHUDExt::BeginSelectionSession(const FVector2D& FirstPoint, bool bActorMustBeFullyEnclosed, bool bUseBoundsSphere)
+{
+    EndSelectionSession();
+
+    SelectionSession.FirstPoint = FirstPoint;
+    SelectionSession.bActorMustBeFullyEnclosed = bActorMustBeFullyEnclosed;
+    SelectionSession.bUseBoundsSphere = bUseBoundsSphere;
+    SelectionSession.bActive = true;
+}
+
+void AHUDExt::UpdateSelectionSession(const FVector2D& SecondPoint, TArray<AActor*>& OutAddedActors, TArray<AActor*>& OutRemovedActors)
+{
+    OutAddedActors.Reset();
+    OutRemovedActors.Reset();
+
+    if (! SelectionSession.bActive || ! Canvas || ! Canvas->SceneView)
+    {
+        return;
+    }
+
+    SCOPE_CYCLE_COUNTER(STAT_HUDExt_SelectionRectangle);
+
+    FBox2D SelectionRectangle(ForceInit);
+    SelectionRectangle += SelectionSession.FirstPoint;
+    SelectionRectangle += SecondPoint;
+
+    const FBox2D PrevRectangle(SelectionSession.Rectangle);
+    const FHUDExtProjection Projection(*Canvas);
+    const FMatrix& ViewProjection(Canvas->SceneView->ViewMatrices.GetViewProjectionMatrix());
+
+    // Rectangle strips that changed since the previous update, empty if all candidates require testing
+    TArray<FBox2D, TInlineAllocator<4>> Strips;
+
+    SelectionCandidates.Reset();
+
+    if (PrevRectangle.bIsValid && ViewProjection.Equals(SelectionSession.ViewProjection, 0.f))
+    {
+        if (PrevRectangle.Min == SelectionRectangle.Min && PrevRectangle.Max == SelectionRectangle.Max)
+        {
+            return;
+        }
+
+        const FBox2D Union(
+            FVector2D::Min(PrevRectangle.Min, SelectionRectangle.Min),
+            FVector2D::Max(PrevRectangle.Max, SelectionRectangle.Max)
+            );
+        const FBox2D Overlap(
+            FVector2D::Max(PrevRectangle.Min, SelectionRectangle.Min),
+            FVector2D::Min(PrevRectangle.Max, SelectionRectangle.Max)
+            );
+
+        if (Overlap.Min.X < Overlap.Max.X && Overlap.Min.Y < Overlap.Max.Y)
+        {
+            // Union minus overlap, covers the symmetric difference of both rectangles
+            Strips.Emplace(FVector2D(Union.Min.X, Union.Min.Y), FVector2D(Union.Max.X, Overlap.Min.Y));
+            Strips.Emplace(FVector2D(Union.Min.X, Overlap.Max.Y), FVector2D(Union.Max.X, Union.Max.Y));
+            Strips.Emplace(FVector2D(Union.Min.X, Overlap.Min.Y), FVector2D(Overlap.Min.X, Overlap.Max.Y));
+            Strips.Emplace(FVector2D(Overlap.Max.X, Overlap.Min.Y), FVector2D(Union.Max.X, Overlap.Max.Y));
+        }
+        else
+        {
+            Strips.Emplace(PrevRectangle);
+            Strips.Emplace(SelectionRectangle);
+        }
+
+        // Gather candidates of non-empty strips, expanded to avoid degenerate selection frustums
+        for (int32 i=Strips.Num()-1; i>=0; --i)
+        {
+            const FVector2D StripSize(Strips[i].GetSize());
+
+            if (StripSize.X <= 0.f || StripSize.Y <= 0.f)
+            {
+                Strips.RemoveAtSwap(i, 1, false);
+                continue;
+            }
+
+            Strips[i] = Strips[i].ExpandBy(1.f);
+            GatherSelectionCandidates(Strips[i]);
+        }
+    }
+    else
+    {
+        // Session start or view changed, test candidates of the whole rectangle and the current selection
+        GatherSelectionCandidates(SelectionRectangle);
+
+        for (const TWeakObjectPtr<USceneComponent>& Selected : SelectionSession.Selected)
+        {
+            if (USceneComponent* Comp = Selected.Get())
+            {
+                SelectionCandidates.Emplace(Comp);
+            }
+        }
+
+        SelectionSession.ViewProjection = ViewProjection;
+    }
+
+    SelectionSession.Rectangle = SelectionRectangle;
+
+    INC_DWORD_STAT_BY(STAT_HUDExt_SelectionCandidates, SelectionCandidates.Num());
+
+    // Test candidates, strips may share candidates
+    TSet<USceneComponent*> Tested;
+    Tested.Reserve(SelectionCandidates.Num());
+
+    for (USceneComponent* Comp : SelectionCandidates)
+    {
+        bool bAlreadyTested = false;
+        Tested.Add(Comp, &bAlreadyTested);
+
+        if (bAlreadyTested || ! IsValid(Comp) || ! Comp->GetOwner())
+        {
+            continue;
+        }
+
+        FBox2D ActorBox2D(ForceInit);
+        const bool bProjected = Projection.Project(Comp->Bounds, SelectionSession.bUseBoundsSphere, ActorBox2D);
+
+        // Skip units outside of the changed strips, their selection state is unchanged
+        if (Strips.Num() > 0)
+        {
+            bool bInStrips = false;
+
+            for (const FBox2D& Strip : Strips)
+            {
+                if (bProjected && Strip.Intersect(ActorBox2D))
+                {
+                    bInStrips = true;
+                    break;
+                }
+            }
+
+            if (! bInStrips)
+            {
+                continue;
+            }
+        }
+
+        const bool bSelected = bProjected && IsInSelectionRectangle(SelectionRectangle, ActorBox2D, SelectionSession.bActorMustBeFullyEnclosed);
+        const bool bWasSelected = SelectionSession.Selected.Contains(Comp);
+
+        if (bSelected && ! bWasSelected)
+        {
+            SelectionSession.Selected.Add(Comp);
+            OutAddedActors.Add(Comp->GetOwner());
+        }
+        else if (! bSelected && bWasSelected)
+        {
+            SelectionSession.Selected.Remove(Comp);
+            OutRemovedActors.Add(Comp->GetOwner());
+        }
+    }
+
+    // Remove destroyed components from selection
+    for (TSet<TWeakObjectPtr<USceneComponent>>::TIterator It(SelectionSession.Selected); It; ++It)
+    {
+        if (! It->IsValid())
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
+
+void AHUDExt::EndSelectionSession()
+{
+    SelectionSession = FSelectionSession();
+}
+
+bool AHUDExt::IsSelectionSessionActive() const
+{
+    return SelectionSession.bActive;
+}
+
+void AHUDExt::GetSelectionSessionActors(TArray<AActor*>& OutActors) const
+{
+    OutActors.Reset();
+
+    for (const TWeakObjectPtr<USceneComponent>& Selected : SelectionSession.Selected)
+    {
+        USceneComponent* Comp = Selected.Get();
+
+        if (Comp && Comp->GetOwner())
+        {
+            OutActors.Add(Comp->GetOwner());
+        }
+    }
+}
@@ -28,6 +28,44 @@
 #include "SplineFollowingMovementComponent.h"
 #include "VSmoothDeltaActor.h"
 #include "Components/SplineComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+#include "WorldCollision.h"
+
+USplineFollowingMovementComponent::USplineFollowingMovementComponent(const FObjectInitializer& ObjectInitializer)
+    : Super(ObjectInitializer)
+{
+    bUseBakedSpline = false;
+    bUseBatchEvaluation = false;
+    BatchIndex = INDEX_NONE;
+
+    bKinematicMovement = false;
+    KinematicOverlapInterval = .2f;
+    KinematicOverlapObjectTypes.Add(UEngineTypes::ConvertToObjectType(ECC_Pawn));
+    KinematicOverlapObjectTypes.Add(UEngineTypes::ConvertToObjectType(ECC_PhysicsBody));
+    KinematicOverlapObjectTypes.Add(UEngineTypes::ConvertToObjectType(ECC_Vehicle));
+    KinematicOverlapTime = 0.f;
+    bKinematicOverlapEventsDisabled = false;
+}
+
+void USplineFollowingMovementComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction)
+{
+    // Evaluate batch group before the first follower of the group advances its simulation time
+    if (BatchGroup.IsValid())
+    {
+        BatchGroup->Evaluate();
+    }
+
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+}
+
+void USplineFollowingMovementComponent::OnUnregister()
+{
+    FVSplineFollowerBatch::Unregister(this, BatchGroup);
+    SetKinematicCollisionEnabled(false);
+
+    Super::OnUnregister();
+}
 
 void USplineFollowingMovementComponent::MovementSourceChange()
 {
@@ -41,9 +79,98 @@ void USplineFollowingMovementComponent::MovementSourceChange()
         SplineSource = nullptr;
     }
 
+    BakedSpline.Reset();
+    UpdateBakedSpline();
+    UpdateBatchGroup();
+
     Super::MovementSourceChange();
 }
 
+void USplineFollowingMovementComponent::UpdateBatchGroup()
+{
+    const bool bRequireGroup = bUseBatchEvaluation && bUseBakedSpline && SplineSource;
+
+    // Leave current group if no longer required or spline source has changed
+    if (BatchGroup.IsValid() && (! bRequireGroup || BatchGroup->GetSpline() != SplineSource))
+    {
+        FVSplineFollowerBatch::Unregister(this, BatchGroup);
+    }
+
+    if (bRequireGroup && ! BatchGroup.IsValid())
+    {
+        BatchGroup = FVSplineFollowerBatch::Register(this, SplineSource);
+    }
+}
+
+float USplineFollowingMovementComponent::GetPredictedSplineTime() const
+{
+    const UWorld* World = GetWorld();
+    const AActor* Owner = GetOwner();
+
+    if (! World || ! Owner || ! HasValidSource())
+    {
+        return 0.f;
+    }
+
+    // Same time step as movement update, see UVSmoothDeltaMovementComponent::StartMovementUpdate()
+    const float DeltaTime = World->GetDeltaSeconds() * Owner->CustomTimeDilation;
+    return GetSplineTime(GetClampedSimulationTime(CurrentSimulationTime + DeltaTime), SplineSource->Duration);
+}
+
+void USplineFollowingMovementComponent::UpdateBakedSpline()
+{
+    if (bUseBakedSpline && SplineSource)
+    {
+        if (! BakedSpline.IsValid() || FVBakedSplineCache::IsOutdated(*BakedSpline, *SplineSource))
+        {
+            BakedSpline = FVBakedSplineCache::GetBakedSpline(SplineSource);
+        }
+    }
+    else
+    {
+        BakedSpline.Reset();
+    }
+}
+
+FVector USplineFollowingMovementComponent::GetSourceLocationAtTime(float SplineTime) const
+{
+    check(SplineSource);
+
+    if (BakedSpline.IsValid())
+    {
+        return SplineSource->GetComponentTransform().TransformPosition(BakedSpline->GetLocationAtTime(SplineTime));
+    }
+
+    return SplineSource->GetLocationAtTime(SplineTime, ESplineCoordinateSpace::World, true);
+}
+
+FQuat USplineFollowingMovementComponent::GetSourceQuaternionAtTime(float SplineTime) const
+{
+    check(SplineSource);
+
+    if (BakedSpline.IsValid())
+    {
+        return SplineSource->GetComponentTransform().TransformRotation(BakedSpline->GetQuaternionAtTime(SplineTime));
+    }
+
+    return SplineSource->GetQuaternionAtTime(SplineTime, ESplineCoordinateSpace::World, true);
+}
+
+FTransform USplineFollowingMovementComponent::GetSourceTransformAtTime(float SplineTime) const
+{
+    check(SplineSource);
+
+    if (BakedSpline.IsValid())
+    {
+        // Match USplineComponent::GetTransformAtTime() without scale
+        FTransform Transform(BakedSpline->GetTransformAtTime(SplineTime) * SplineSource->GetComponentTransform());
+        Transform.RemoveScaling();
+        return Transform;
+    }
+
+    return SplineSource->GetTransformAtTime(SplineTime, ESplineCoordinateSpace::World, true);
+}
+
 void USplineFollowingMovementComponent::MovementUpdate(float DeltaTime)
 {
     // Perform movement update with impact handling
@@ -62,18 +189,42 @@ void USplineFollowingMovementComponent::MovementUpdateImpl(float DeltaTime, bool
 
     bJustTeleported = false;
 
+    UpdateBakedSpline();
+
     const float SplineTime = GetSplineTime(SplineSource->Duration);
     const FVector OldLocation = UpdatedComponent->GetComponentLocation();
-    const FVector NewLocation = SplineSource->GetLocationAtTime(SplineTime, ESplineCoordinateSpace::World, true);
+
+    FVector NewLocation;
+    FQuat NewRotation;
+
+    // Use batch evaluated transform if available, otherwise evaluate spline source
+    if (! BatchGroup.IsValid() || ! BatchGroup->GetTransform(this, SplineTime, NewLocation, NewRotation))
+    {
+        const FTransform NewTransform = GetSourceTransformAtTime(SplineTime);
+        NewLocation = NewTransform.GetLocation();
+        NewRotation = NewTransform.GetRotation();
+    }
+
     const FVector DeltaLocation = NewLocation - OldLocation;
-    const FQuat NewRotation = SplineSource->GetQuaternionAtTime(SplineTime, ESplineCoordinateSpace::World, true);
 
-    FHitResult Hit(1.f);
-    SafeMoveUpdatedComponent(DeltaLocation, NewRotation, true, Hit);
+    SetKinematicCollisionEnabled(bKinematicMovement);
 
-    if (bHandleImpact && Hit.Time < 1.f)
+    if (bKinematicMovement)
+    {
+        // Teleport without sweep, contacts are resolved by reduced rate overlap queries.
+        // Simulated proxies also run the queries to keep overlap events, blocking contacts are left to the server.
+        MoveUpdatedComponent(DeltaLocation, NewRotation, false, nullptr, ETeleportType::TeleportPhysics);
+        UpdateKinematicContacts(DeltaTime, bHandleImpact);
+    }
+    else
     {
-        HandleImpact(Hit, DeltaTime, DeltaLocation);
+        FHitResult Hit(1.f);
+        SafeMoveUpdatedComponent(DeltaLocation, NewRotation, true, Hit);
+
+        if (bHandleImpact && Hit.Time < 1.f)
+        {
+            HandleImpact(Hit, DeltaTime, DeltaLocation);
+        }
     }
 
     if (!bJustTeleported)
@@ -82,6 +233,223 @@ void USplineFollowingMovementComponent::MovementUpdateImpl(float DeltaTime, bool
     }
 }
 
+void USplineFollowingMovementComponent::SetKinematicCollisionEnabled(bool bEnabled)
+{
+    if (bEnabled)
+    {
+        // Disable per move overlap updates, kinematic contacts replace them
+        if (UpdatedPrimitive && UpdatedPrimitive->bGenerateOverlapEvents)
+        {
+            UpdatedPrimitive->bGenerateOverlapEvents = false;
+            bKinematicOverlapEventsDisabled = true;
+        }
+    }
+    else
+    {
+        ClearKinematicContacts();
+        KinematicOverlapTime = 0.f;
+
+        // Restore overlap events disabled by kinematic movement
+        if (bKinematicOverlapEventsDisabled)
+        {
+            if (UpdatedPrimitive)
+            {
+                UpdatedPrimitive->bGenerateOverlapEvents = true;
+                UpdatedPrimitive->UpdateOverlaps();
+            }
+
+            bKinematicOverlapEventsDisabled = false;
+        }
+    }
+}
+
+void USplineFollowingMovementComponent::UpdateKinematicContacts(float DeltaTime, bool bHandleImpact)
+{
+    KinematicOverlapTime += DeltaTime;
+
+    if (KinematicOverlapTime < KinematicOverlapInterval)
+    {
+        return;
+    }
+
+    UWorld* World = GetWorld();
+    const float QueryDeltaTime = KinematicOverlapTime;
+    KinematicOverlapTime = 0.f;
+
+    if (! World || ! UpdatedPrimitive || ! SDOwner)
+    {
+        return;
+    }
+
+    const FCollisionObjectQueryParams ObjectParams(KinematicOverlapObjectTypes);
+
+    if (! ObjectParams.IsValid())
+    {
+        ClearKinematicContacts();
+        return;
+    }
+
+    FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(SplineFollowingKinematicOverlap), false, SDOwner);
+    TArray<FOverlapResult> Overlaps;
+
+    World->OverlapMultiByObjectType(
+        Overlaps,
+        UpdatedPrimitive->GetComponentLocation(),
+        UpdatedPrimitive->GetComponentQuat(),
+        ObjectParams,
+        UpdatedPrimitive->GetCollisionShape(),
+        QueryParams
+        );
+
+    TArray<TWeakObjectPtr<UPrimitiveComponent>> OldContacts(MoveTemp(KinematicContacts));
+    KinematicContacts.Reset(Overlaps.Num());
+
+    for (const FOverlapResult& Overlap : Overlaps)
+    {
+        UPrimitiveComponent* OtherComp = Overlap.GetComponent();
+
+        if (! OtherComp || ! OtherComp->GetOwner() || KinematicContacts.Contains(OtherComp))
+        {
+            continue;
+        }
+
+        // Ignore contacts the updated primitive does not respond to
+        if (UpdatedPrimitive->GetCollisionResponseToComponent(OtherComp) == ECR_Ignore)
+        {
+            continue;
+        }
+
+        KinematicContacts.Emplace(OtherComp);
+
+        if (! OldContacts.Contains(OtherComp))
+        {
+            OnKinematicContactBegin(OtherComp, QueryDeltaTime, bHandleImpact);
+        }
+    }
+
+    for (const TWeakObjectPtr<UPrimitiveComponent>& OldContact : OldContacts)
+    {
+        if (OldContact.IsValid() && ! KinematicContacts.Contains(OldContact))
+        {
+            OnKinematicContactEnd(OldContact.Get());
+        }
+    }
+}
+
+void USplineFollowingMovementComponent::ClearKinematicContacts()
+{
+    TArray<TWeakObjectPtr<UPrimitiveComponent>> OldContacts(MoveTemp(KinematicContacts));
+    KinematicContacts.Reset();
+
+    for (const TWeakObjectPtr<UPrimitiveComponent>& OldContact : OldContacts)
+    {
+        if (OldContact.IsValid())
+        {
+            OnKinematicContactEnd(OldContact.Get());
+        }
+    }
+}
+
+void USplineFollowingMovementComponent::OnKinematicContactBegin(UPrimitiveComponent* OtherComp, float DeltaTime, bool bHandleImpact)
+{
+    check(OtherComp);
+
+    if (! UpdatedPrimitive || ! SDOwner)
+    {
+        return;
+    }
+
+    AActor* OtherActor = OtherComp->GetOwner();
+    const FVector Location = UpdatedPrimitive->GetComponentLocation();
+
+    if (UpdatedPrimitive->GetCollisionResponseToComponent(OtherComp) == ECR_Block)
+    {
+        // Blocking contacts are handled by the server
+        if (! bHandleImpact)
+        {
+            return;
+        }
+
+        // Construct blocking hit from the closest point of the contact
+        FVector ImpactPoint;
+        if (OtherComp->GetClosestPointOnCollision(Location, ImpactPoint) <= 0.f)
+        {
+            ImpactPoint = OtherComp->GetComponentLocation();
+        }
+
+        FHitResult Hit(0.f);
+        Hit.bBlockingHit = true;
+        Hit.bStartPenetrating = true;
+        Hit.Location = Location;
+        Hit.ImpactPoint = ImpactPoint;
+        Hit.Normal = (Location - ImpactPoint).GetSafeNormal();
+
+        // Closest point may coincide with the location if the contact is deeply penetrating,
+        // fall back to the contact origin direction, then to the reversed movement direction
+        if (Hit.Normal.IsZero())
+        {
+            Hit.Normal = (Location - OtherComp->GetComponentLocation()).GetSafeNormal();
+        }
+
+        if (Hit.Normal.IsZero())
+        {
+            Hit.Normal = (-Velocity).GetSafeNormal();
+        }
+
+        if (Hit.Normal.IsZero())
+        {
+            Hit.Normal = FVector::UpVector;
+        }
+
+        Hit.ImpactNormal = Hit.Normal;
+        Hit.TraceStart = Location;
+        Hit.TraceEnd = Location;
+        Hit.Actor = OtherActor;
+        Hit.Component = OtherComp;
+
+        HandleImpact(Hit, DeltaTime, Velocity * DeltaTime);
+        UpdatedPrimitive->DispatchBlockingHit(*SDOwner, Hit);
+    }
+    else
+    {
+        // Dispatch on both sides, engine overlap updates that would notify the other side are disabled
+        UpdatedPrimitive->OnComponentBeginOverlap.Broadcast(UpdatedPrimitive, OtherActor, OtherComp, INDEX_NONE, false, FHitResult());
+        OtherComp->OnComponentBeginOverlap.Broadcast(OtherComp, SDOwner, UpdatedPrimitive, INDEX_NONE, false, FHitResult());
+
+        if (OtherActor && OtherActor != SDOwner)
+        {
+            SDOwner->NotifyActorBeginOverlap(OtherActor);
+            SDOwner->OnActorBeginOverlap.Broadcast(SDOwner, OtherActor);
+            OtherActor->NotifyActorBeginOverlap(SDOwner);
+            OtherActor->OnActorBeginOverlap.Broadcast(OtherActor, SDOwner);
+        }
+    }
+}
+
+void USplineFollowingMovementComponent::OnKinematicContactEnd(UPrimitiveComponent* OtherComp)
+{
+    check(OtherComp);
+
+    // Blocking contacts only dispatch hit events on begin
+    if (! UpdatedPrimitive || ! SDOwner || UpdatedPrimitive->GetCollisionResponseToComponent(OtherComp) == ECR_Block)
+    {
+        return;
+    }
+
+    AActor* OtherActor = OtherComp->GetOwner();
+
+    UpdatedPrimitive->OnComponentEndOverlap.Broadcast(UpdatedPrimitive, OtherActor, OtherComp, INDEX_NONE);
+    OtherComp->OnComponentEndOverlap.Broadcast(OtherComp, SDOwner, UpdatedPrimitive, INDEX_NONE);
+
+    if (OtherActor && OtherActor != SDOwner)
+    {
+        SDOwner->NotifyActorEndOverlap(OtherActor);
+        SDOwner->OnActorEndOverlap.Broadcast(SDOwner, OtherActor);
+        OtherActor->NotifyActorEndOverlap(SDOwner);
+        OtherActor->OnActorEndOverlap.Broadcast(OtherActor, SDOwner);
+    }
+}
+
 void USplineFollowingMovementComponent::MoveSmooth(float DeltaTime)
 {
     // Perform movement update without handling hit impact on client proxies
@@ -135,11 +503,11 @@ void USplineFollowingMovementComponent::MoveSmooth_Visual()
         }
         else
         {
-            OffsetTime = GetClampedSimulationTime(Duration-OffsetTime);
+            OffsetTime = GetClampedSimulationTime(Duration+OffsetTime);
         }
 
         const float SplineTime = GetSplineTime(OffsetTime, SplineSource->Duration);
-        Mesh->SetWorldTransform(SplineSource->GetTransformAtTime(SplineTime, ESplineCoordinateSpace::World, true));
+        Mesh->SetWorldTransform(GetSourceTransformAtTime(SplineTime));
     }
     else if (NetworkSmoothingMode == ENetworkSmoothingMode::Replay)
     {
@@ -164,8 +532,10 @@ void USplineFollowingMovementComponent::SnapToCurrentTime()
         return;
     }
 
+    UpdateBakedSpline();
+
     const float SplineTime = GetSplineTime(SplineSource->Duration);
-    UpdatedComponent->SetWorldTransform(SplineSource->GetTransformAtTime(SplineTime, ESplineCoordinateSpace::World, true));
+    UpdatedComponent->SetWorldTransform(GetSourceTransformAtTime(SplineTime));
 
     bJustTeleported = true;
 }
@@ -206,7 +576,7 @@ float USplineFollowingMovementComponent::GetSplineTime(float InSplineDuration) c
 
 float USplineFollowingMovementComponent::GetSplineTime(float InSimulationTime, float InSplineDuration) const
 {
-    return GetSplineTime(CurrentSimulationTime, Duration, InSplineDuration);
+    return GetSplineTime(InSimulationTime, Duration, InSplineDuration);
 }
 
 float USplineFollowingMovementComponent::GetSplineTime(float InSimulationTime, float InSimulationDuration, float InSplineDuration) const
@@ -40,11 +40,38 @@ FSteeringTarget USteeringBehaviorUtility::MakeTargetRotation(const FRotator& InR
     return FSteeringTarget(InRotation);
 }
 
+FSteeringTarget USteeringBehaviorUtility::MakeTargetComponent(USceneComponent* InComponent)
+{
+    return FSteeringTarget(InComponent);
+}
+
 FSteeringTarget USteeringBehaviorUtility::MakeTargetDirection(const FVector& InDirection)
 {
     return FSteeringTarget(InDirection.ToOrientationQuat());
 }
 
+FVector USteeringBehaviorUtility::GetTargetLocation(const FSteeringTarget& InSteeringTarget)
+{
+    return InSteeringTarget.GetLocation();
+}
+
+FRotator USteeringBehaviorUtility::GetTargetRotation(const FSteeringTarget& InSteeringTarget)
+{
+    return InSteeringTarget.GetRotation().Rotator();
+}
+
+USceneComponent* USteeringBehaviorUtility::GetTargetComponent(const FSteeringTarget& InSteeringTarget)
+{
+    return InSteeringTarget.GetComponent();
+}
+
+void USteeringBehaviorUtility::BreakSteeringTarget(const FSteeringTarget& InSteeringTarget, FVector& Location, FRotator& Rotation, USceneComponent*& TargetComponent)
+{
+    Location = InSteeringTarget.GetLocation();
+    Rotation = InSteeringTarget.GetRotation().Rotator();
+    TargetComponent = InSteeringTarget.GetComponent();
+}
+
 FSteeringBehaviorRef USteeringBehaviorUtility::CreateArriveBehavior(const FSteeringTarget& InSteeringTarget, float InOuterRadius, float InInnerRadius)
 {
     FPSSteeringBehavior Behavior( new FArriveBehavior(InSteeringTarget, InOuterRadius, InInnerRadius) );
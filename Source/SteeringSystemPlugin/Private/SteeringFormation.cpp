@@ -27,6 +27,8 @@
 
 #include "SteeringFormation.h"
 #include "FormationBehavior.h"
+#include "VSteeringTrace.h"
+#include "VSteeringMemory.h"
 
 void FDefaultFormationPattern::CalculateDimension()
 {
@@ -201,6 +203,7 @@ FSteeringFormation::FSteeringFormation()
     , Primary(nullptr)
     , VelocityLimit(0.f)
     , Orientation(FQuat::Identity)
+    , SlotRevision(0)
     , bRequirePatternUpdate(true)
 {
     SetDefaultFormationPattern();
@@ -243,13 +246,17 @@ void FSteeringFormation::UpdatePrimaryAssignment()
 void FSteeringFormation::UpdateFormationPattern()
 {
     check(FormationPattern.IsValid());
+    INC_DWORD_STAT(STAT_VFormationPatternUpdates);
+    STEERING_TRACE(FormationPatternRebuild, PointerHash(this), NAME_None, Members.Num());
     FormationPattern->UpdateFormationPattern();
 }
 
 void FSteeringFormation::UpdateSlotAssignments()
 {
     check(SlotAssignmentStrategy.IsValid());
+    INC_DWORD_STAT(STAT_VFormationSlotReassignments);
     SlotAssignmentStrategy->UpdateSlotAssignments();
+    TraceSlotReassignment();
 }
 
 void FSteeringFormation::UpdateBehavior(float DeltaTime)
@@ -283,18 +290,24 @@ bool FSteeringFormation::UpdateActiveBehavior(float DeltaTime)
         if (! Behavior->IsActive())
         {
             Behavior->Activate();
+            STEERING_TRACE(BehaviorActivated, PointerHash(this), Behavior->GetType(), 0.f);
         }
 
-        bIsDone = Behavior->CalculateSteering(DeltaTime);
+        {
+            SCOPE_STEERING_BEHAVIOR_STAT(Behavior);
+            bIsDone = Behavior->CalculateSteering(DeltaTime);
+        }
 
         if (bIsDone)
         {
             if (Behavior->IsActive())
             {
                 Behavior->Deactivate();
+                STEERING_TRACE(BehaviorDeactivated, PointerHash(this), Behavior->GetType(), 0.f);
             }
 
             bInProgress = false;
+            STEERING_TRACE(BehaviorDone, PointerHash(this), Behavior->GetType(), 0.f);
         }
     }
 
@@ -323,6 +336,7 @@ void FSteeringFormation::UpdateFormation(float DeltaTime)
     {
         UpdateFormationPattern();
         UpdateSlotAssignments();
+        ++SlotRevision;
     }
 
     // Update formation behavior
@@ -494,6 +508,40 @@ void FSteeringFormation::SetPrimaryAssignmentStrategy(FPSPrimaryAssignmentStrate
     }
 }
 
+void FSteeringFormation::SetSlotAssignments(const FSlotAssignmentMap& InSlotMap)
+{
+    TArray<ISteerable*> InMembers;
+    InSlotMap.GenerateKeyArray(InMembers);
+
+    // Only reassign members if member set has changed
+    bool bMembersChanged = (InMembers.Num() != Members.Num());
+
+    for (int32 i=0; ! bMembersChanged && i<InMembers.Num(); ++i)
+    {
+        bMembersChanged = ! SlotMap.Contains(InMembers[i]);
+    }
+
+    if (bMembersChanged)
+    {
+        SetMembers(InMembers);
+    }
+
+    // Update pattern and override slot assignments
+    UpdateFormationPattern();
+    SlotMap = InSlotMap;
+    INC_DWORD_STAT(STAT_VFormationSlotReassignments);
+    TraceSlotReassignment();
+
+    bRequirePatternUpdate = false;
+    ++SlotRevision;
+}
+
+FFormationBehavior* FSteeringFormation::GetActiveBehavior() const
+{
+    const FFormationBehaviorListNode* Node = Behaviors.GetTail();
+    return Node ? Node->GetValue().Get() : nullptr;
+}
+
 void FSteeringFormation::CalculateSlotLocation(ISteerable* Member, FVector& SlotLocation)
 {
     check(HasValidData());
@@ -537,6 +585,52 @@ void FSteeringFormation::CalculateSlotOrientation(ISteerable* Member, FQuat& Slo
     }
 }
 
+// ~ Memory Accounting
+
+SIZE_T FSteeringFormation::GetAllocatedSize() const
+{
+    SIZE_T AllocatedSize = 0;
+
+    AllocatedSize += Members.GetAllocatedSize();
+    AllocatedSize += SlotMap.GetAllocatedSize();
+    AllocatedSize += FVSteeringMemory::GetBehaviorListSize(Behaviors);
+    AllocatedSize += FVSteeringMemory::GetSharedAllocatedSize(PrimaryAssignmentStrategy);
+    AllocatedSize += FVSteeringMemory::GetSharedAllocatedSize(FormationPattern);
+    AllocatedSize += FVSteeringMemory::GetSharedAllocatedSize(SlotAssignmentStrategy);
+
+    return AllocatedSize;
+}
+
+// ~ Trace Functions
+
+FName FSteeringFormation::GetTraceMemberName(ISteerable* Member)
+{
+    UObject* MemberObject = Member ? Member->GetSteerableObject() : nullptr;
+    return MemberObject ? MemberObject->GetFName() : NAME_None;
+}
+
+void FSteeringFormation::TraceSlotReassignment()
+{
+#if STEERING_TRACE_ENABLED
+    if (! FVSteeringTrace::IsEnabled() || ! HasValidData())
+    {
+        return;
+    }
+
+    // Total distance members have to travel to their newly assigned slots
+    float TravelDistance = 0.f;
+
+    for (ISteerable* Member : Members)
+    {
+        FVector SlotLocation(Member->GetSteerableLocation());
+        CalculateSlotLocation(Member, SlotLocation);
+        TravelDistance += FVector::Dist(Member->GetSteerableLocation(), SlotLocation);
+    }
+
+    FVSteeringTrace::Record(EVSteeringTraceEvent::FormationSlotReassignment, PointerHash(this), NAME_None, TravelDistance);
+#endif
+}
+
 // ~ Formation Member Functions
 
 void FSteeringFormation::AddMemberDependency(ISteerable* Member)
@@ -598,6 +692,8 @@ bool FSteeringFormation::AddMember(ISteerable* Member, bool bSetAsPrimary)
         // Add member dependency, if anchor presents
         AddMemberDependency(Member);
 
+        STEERING_TRACE(FormationMemberAdded, PointerHash(this), GetTraceMemberName(Member), Members.Num());
+
         // Set added member as primary if required
         if (bSetAsPrimary)
         {
@@ -631,6 +727,8 @@ bool FSteeringFormation::RemoveMember(ISteerable* Member)
         // Remove member dependency, if anchor presents
         RemoveMemberDependency(Member);
 
+        STEERING_TRACE(FormationMemberRemoved, PointerHash(this), GetTraceMemberName(Member), Members.Num());
+
         // Mark formation update
         MarkPatternUpdate();
 
@@ -26,6 +26,10 @@
 // 
 
 #include "SteeringFormationComponent.h"
+#include "GameFramework/Actor.h"
+#include "Net/UnrealNetwork.h"
+#include "VPSteerableComponent.h"
+#include "VSteeringMemory.h"
 
 USteeringFormationComponent::USteeringFormationComponent(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -38,12 +42,30 @@ USteeringFormationComponent::USteeringFormationComponent(const FObjectInitialize
 	bAutoUpdateTickRegistration = true;
 
     UpdatedComponent = nullptr;
+
+    bReplicateFormationIntent = false;
+    MemberCorrectionNetUpdateFrequency = 2.f;
+    MemberSlotApproachTime = .5f;
+    ReplicatedSlotRevision = 0;
+}
+
+void USteeringFormationComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(USteeringFormationComponent, ReplicatedFormationState);
 }
 
 void USteeringFormationComponent::InitializeComponent()
 {
 	Super::InitializeComponent();
 
+    // Formation intent is replicated through this component
+    if (bReplicateFormationIntent)
+    {
+        SetIsReplicated(true);
+    }
+
 	// RootComponent is null in OnRegister for blueprint (non-native) root components.
 	if (!UpdatedComponent && bAutoRegisterUpdatedComponent)
 	{
@@ -84,12 +106,23 @@ void USteeringFormationComponent::OnRegister()
 
 void USteeringFormationComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+    RestoreMemberNetUpdateFrequencies();
+
     Formation.ClearMembers();
     Formation.ClearBehaviors();
 
     Super::EndPlay(EndPlayReason);
 }
 
+void USteeringFormationComponent::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
+{
+    Super::GetResourceSizeEx(CumulativeResourceSize);
+
+    CumulativeResourceSize.AddDedicatedSystemMemoryBytes(Formation.GetAllocatedSize());
+    CumulativeResourceSize.AddDedicatedSystemMemoryBytes(ReplicatedFormationState.Slots.GetAllocatedSize());
+    CumulativeResourceSize.AddDedicatedSystemMemoryBytes(MemberNetUpdateFrequencies.GetAllocatedSize());
+}
+
 void USteeringFormationComponent::SetUpdatedComponent(USceneComponent* NewUpdatedComponent)
 {
     const bool bUpdatedComponentChanged = UpdatedComponent != NewUpdatedComponent;
@@ -141,9 +174,16 @@ void USteeringFormationComponent::TickComponent(float DeltaTime, ELevelTick Tick
 		SetUpdatedComponent(NULL);
 	}
 
-    if (HasValidData() && (GetOwner()->Role == ROLE_Authority))
+    if (HasValidData())
     {
-        UpdateFormation(DeltaTime);
+        if (GetOwner()->Role == ROLE_Authority)
+        {
+            UpdateFormation(DeltaTime);
+        }
+        else if (bReplicateFormationIntent)
+        {
+            SimulateFormation(DeltaTime);
+        }
     }
 }
 
@@ -152,6 +192,188 @@ void USteeringFormationComponent::UpdateFormation(float DeltaTime)
     check(HasValidData());
 
     Formation.UpdateFormation(DeltaTime);
+
+    if (bReplicateFormationIntent)
+    {
+        UpdateReplicatedFormationState();
+    }
+}
+
+// ~ Formation Intent Replication
+
+void USteeringFormationComponent::UpdateReplicatedFormationState()
+{
+    FSteeringFormationRepState& State(ReplicatedFormationState);
+
+    State.AnchorLocation = Formation.GetAnchorLocation();
+    State.AnchorRotation = Formation.GetAnchorOrientation().Rotator();
+    State.Orientation = Formation.GetOrientation().Rotator();
+    State.VelocityLimit = Formation.GetVelocityLimit();
+
+    // Replicate active behavior movement target instead of member transforms
+    FFormationBehavior* Behavior = Formation.GetActiveBehavior();
+    FVector TargetLocation(FVector::ZeroVector);
+
+    State.bHasTarget = Behavior && Behavior->GetMovementTarget(TargetLocation);
+    State.TargetLocation = TargetLocation;
+    State.AnchorSpeed = State.bHasTarget ? Behavior->GetAnchorSpeed() : 0.f;
+
+    // Slot assignments only change on pattern update, skip rebuild otherwise
+    if (ReplicatedSlotRevision != Formation.GetSlotRevision())
+    {
+        const FSlotAssignmentMap& SlotMap(Formation.GetSlotMap());
+
+        State.Slots.Reset(SlotMap.Num());
+
+        for (const FSlotAssignmentPair& Slot : SlotMap)
+        {
+            UVPSteerableComponent* Member = Slot.Key ? Cast<UVPSteerableComponent>(Slot.Key->GetSteerableObject()) : nullptr;
+
+            if (Member)
+            {
+                State.Slots.Emplace(Member, Slot.Value);
+            }
+        }
+
+        ReplicatedSlotRevision = Formation.GetSlotRevision();
+
+        UpdateMemberNetUpdateFrequencies();
+    }
+}
+
+void USteeringFormationComponent::UpdateMemberNetUpdateFrequencies()
+{
+    TSet<AActor*> MemberActors;
+    MemberActors.Reserve(ReplicatedFormationState.Slots.Num());
+
+    // Lower net update frequency of new members, member snapshots are only used as corrections
+    for (const FSteeringFormationRepSlot& Slot : ReplicatedFormationState.Slots)
+    {
+        AActor* MemberActor = Slot.Member ? Slot.Member->GetOwner() : nullptr;
+
+        if (MemberActor)
+        {
+            MemberActors.Emplace(MemberActor);
+
+            if (! MemberNetUpdateFrequencies.Contains(MemberActor))
+            {
+                MemberNetUpdateFrequencies.Emplace(MemberActor, MemberActor->NetUpdateFrequency);
+                MemberActor->NetUpdateFrequency = FMath::Min(MemberActor->NetUpdateFrequency, MemberCorrectionNetUpdateFrequency);
+            }
+        }
+    }
+
+    // Restore net update frequency of members that left the formation
+    for (auto It = MemberNetUpdateFrequencies.CreateIterator(); It; ++It)
+    {
+        AActor* MemberActor = It.Key().Get();
+
+        if (! MemberActor)
+        {
+            It.RemoveCurrent();
+        }
+        else if (! MemberActors.Contains(MemberActor))
+        {
+            MemberActor->NetUpdateFrequency = It.Value();
+            It.RemoveCurrent();
+        }
+    }
+}
+
+void USteeringFormationComponent::RestoreMemberNetUpdateFrequencies()
+{
+    for (const TPair<TWeakObjectPtr<AActor>, float>& MemberFrequency : MemberNetUpdateFrequencies)
+    {
+        if (AActor* MemberActor = MemberFrequency.Key.Get())
+        {
+            MemberActor->NetUpdateFrequency = MemberFrequency.Value;
+        }
+    }
+
+    MemberNetUpdateFrequencies.Reset();
+}
+
+void USteeringFormationComponent::OnRep_ReplicatedFormationState()
+{
+    if (! HasValidData())
+    {
+        return;
+    }
+
+    const FSteeringFormationRepState& State(ReplicatedFormationState);
+
+    Formation.SetVelocityLimit(State.VelocityLimit);
+    Formation.SetOrientation(State.Orientation.Quaternion());
+
+    // Snap simulated anchor to authoritative anchor
+    Formation.SetAnchorLocationAndOrientation(State.AnchorLocation, State.AnchorRotation.Quaternion());
+
+    // Apply slot assignments, members that are not relevant yet are skipped
+    FSlotAssignmentMap SlotMap;
+    SlotMap.Reserve(State.Slots.Num());
+
+    for (const FSteeringFormationRepSlot& Slot : State.Slots)
+    {
+        if (Slot.Member)
+        {
+            SlotMap.Emplace(Slot.Member, Slot.SlotIndex);
+        }
+    }
+
+    if (! SlotMap.OrderIndependentCompareEqual(Formation.GetSlotMap()))
+    {
+        Formation.SetSlotAssignments(SlotMap);
+    }
+}
+
+void USteeringFormationComponent::SimulateFormation(float DeltaTime)
+{
+    check(HasValidData());
+
+    if (! Formation.HasValidData())
+    {
+        return;
+    }
+
+    const FSteeringFormationRepState& State(ReplicatedFormationState);
+
+    // Extrapolate anchor towards replicated target
+    if (State.bHasTarget && State.AnchorSpeed > 0.f)
+    {
+        const FVector AnchorLocation(Formation.GetAnchorLocation());
+        const FVector TargetDelta(State.TargetLocation - AnchorLocation);
+        const float TargetDist = TargetDelta.Size();
+
+        if (TargetDist > KINDA_SMALL_NUMBER)
+        {
+            const float StepDist = FMath::Min(State.AnchorSpeed * DeltaTime, TargetDist);
+            Formation.SetAnchorLocation(AnchorLocation + TargetDelta * (StepDist / TargetDist));
+        }
+    }
+
+    // Drive simulated members towards their formation slots
+    const float InvApproachTime = 1.f / FMath::Max(MemberSlotApproachTime, KINDA_SMALL_NUMBER);
+
+    for (const FSlotAssignmentPair& Slot : Formation.GetSlotMap())
+    {
+        ISteerable* Member = Slot.Key;
+        UVPSteerableComponent* MemberComponent = Member ? Cast<UVPSteerableComponent>(Member->GetSteerableObject()) : nullptr;
+
+        if (! MemberComponent)
+        {
+            continue;
+        }
+
+        FVector SlotLocation;
+        Formation.CalculateSlotLocation(Member, SlotLocation);
+
+        const float MaxSpeed = Formation.HasVelocityLimit()
+            ? Formation.GetVelocityLimit()
+            : Member->GetMaxLinearSpeed();
+
+        const FVector Velocity((SlotLocation - Member->GetSteerableLocation()) * InvApproachTime);
+        MemberComponent->SetSimulatedVelocity(Velocity.GetClampedToMaxSize(MaxSpeed));
+    }
 }
 
 bool USteeringFormationComponent::HasValidData() const
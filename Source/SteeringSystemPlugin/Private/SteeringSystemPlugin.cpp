@@ -26,20 +26,38 @@
 //
 
 #include "SteeringSystemPlugin.h"
+#include "Engine/World.h"
+#include "VBakedSplineCache.h"
+#include "VSteeringTargetCache.h"
 
 #define LOCTEXT_NAMESPACE "FSteeringSystemPlugin"
 
 void FSteeringSystemPlugin::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
-	
+
+    // Release baked splines of worlds being torn down
+    WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddLambda([](UWorld* World, bool bSessionEnded, bool bCleanupResources)
+    {
+        FVBakedSplineCache::PurgeWorldEntries(World);
+    });
+
+    // Resolve component steering targets before actors evaluate steering
+    WorldPreActorTickHandle = FWorldDelegates::OnWorldPreActorTick.AddLambda([](UWorld* World, ELevelTick TickType, float DeltaSeconds)
+    {
+        FVSteeringTargetCache::Resolve();
+    });
 }
 
 void FSteeringSystemPlugin::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
-	
+
+    FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+    FWorldDelegates::OnWorldPreActorTick.Remove(WorldPreActorTickHandle);
+    FVBakedSplineCache::Clear();
+    FVSteeringTargetCache::Clear();
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,250 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+// 
+
+
+#include "Misc/AutomationTest.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "VMockSteerable.h"
+#include "Behaviors/AlignBehavior.h"
+#include "Behaviors/ArriveBehavior.h"
+#include "Behaviors/RepulsionBehavior.h"
+
+#if WITH_EDITOR && WITH_DEV_AUTOMATION_TESTS
+
+namespace VSteeringBehaviorTests
+{
+    static const float DeltaTime = .1f;
+    static const float GoldenTolerance = .1f;
+
+    /**
+     * Golden frames are mock steerable trajectories recorded when the tests were written.
+     * After an intended behavior change, run the tests with -VSteeringLogGoldens to log every frame
+     * as a golden frame initializer, review the new trajectory and replace the old values with it.
+     */
+    static bool ShouldLogGoldens()
+    {
+        return FParse::Param(FCommandLine::Get(), TEXT("VSteeringLogGoldens"));
+    }
+
+    // Expected steerable location after the specified frame update
+    struct FGoldenFrame
+    {
+        int32 Frame;
+        FVector Location;
+    };
+
+    /**
+     * Update steerable for FrameCount frames and compare its trajectory against golden frames.
+     * Also checks the frame on which the behavior stack becomes empty, INDEX_NONE if it never does.
+     */
+    static void RunTrajectory(FAutomationTestBase& Test, FVMockSteerable& Steerable, const FGoldenFrame* GoldenFrames, int32 GoldenCount, int32 FrameCount, int32 ExpectedDoneFrame)
+    {
+        int32 DoneFrame = INDEX_NONE;
+        int32 GoldenIndex = 0;
+
+        for (int32 Frame=1; Frame<=FrameCount; ++Frame)
+        {
+            Steerable.Update(DeltaTime);
+
+            if (DoneFrame == INDEX_NONE && Steerable.GetBehaviorCount() == 0)
+            {
+                DoneFrame = Frame;
+            }
+
+            if (ShouldLogGoldens())
+            {
+                const FVector& Location(Steerable.Location);
+                Test.AddInfo(FString::Printf(TEXT("{ %2d, FVector(%.3ff, %.3ff, %.3ff) },"), Frame, Location.X, Location.Y, Location.Z));
+            }
+
+            if (GoldenIndex < GoldenCount && GoldenFrames[GoldenIndex].Frame == Frame)
+            {
+                const FString What = FString::Printf(TEXT("Location at frame %d"), Frame);
+                Test.TestEqual(*What, Steerable.Location, GoldenFrames[GoldenIndex].Location, GoldenTolerance);
+                ++GoldenIndex;
+            }
+        }
+
+        Test.TestEqual(TEXT("Behavior done frame"), DoneFrame, ExpectedDoneFrame);
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVArriveBehaviorTest, "SteeringSystem.Behaviors.Arrive", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVArriveBehaviorTest::RunTest(const FString& Parameters)
+{
+    using namespace VSteeringBehaviorTests;
+
+    // Target straight ahead: orient on the first frame, full speed until outer radius, then slow down
+    {
+        static const FGoldenFrame GoldenFrames[] = {
+            {  1, FVector(  0.f, 0.f, 0.f) },
+            {  2, FVector( 60.f, 0.f, 0.f) },
+            {  5, FVector(240.f, 0.f, 0.f) },
+            { 10, FVector(540.f, 0.f, 0.f) },
+            { 15, FVector(840.f, 0.f, 0.f) },
+            { 16, FVector(900.f, 0.f, 0.f) },
+            { 17, FVector(940.f, 0.f, 0.f) },
+            { 18, FVector(964.f, 0.f, 0.f) },
+            { 20, FVector(964.f, 0.f, 0.f) }
+        };
+
+        FVMockSteerable Steerable;
+        Steerable.AddSteeringBehavior(FPSSteeringBehavior( new FArriveBehavior(FSteeringTarget(FVector(1000.f, 0.f, 0.f)), Steerable.OuterRadius, Steerable.InnerRadius) ));
+
+        RunTrajectory(*this, Steerable, GoldenFrames, ARRAY_COUNT(GoldenFrames), 20, 19);
+
+        TestEqual(TEXT("Velocity after arrival"), Steerable.Velocity, FVector::ZeroVector, GoldenTolerance);
+    }
+
+    // Off-axis target with initial velocity: turn magnitude scaling, then straight line towards target
+    {
+        static const FGoldenFrame GoldenFrames[] = {
+            {  1, FVector( 24.962f,  16.641f, 0.f) },
+            {  2, FVector( 74.885f,  49.923f, 0.f) },
+            {  5, FVector(224.654f, 149.769f, 0.f) },
+            { 10, FVector(474.269f, 316.179f, 0.f) },
+            { 12, FVector(554.515f, 369.677f, 0.f) },
+            { 13, FVector(572.709f, 381.806f, 0.f) },
+            { 15, FVector(572.709f, 381.806f, 0.f) }
+        };
+
+        FVMockSteerable Steerable;
+        Steerable.Velocity = FVector(600.f, 0.f, 0.f);
+        Steerable.AddSteeringBehavior(FPSSteeringBehavior( new FArriveBehavior(FSteeringTarget(FVector(600.f, 400.f, 0.f)), Steerable.OuterRadius, Steerable.InnerRadius) ));
+
+        RunTrajectory(*this, Steerable, GoldenFrames, ARRAY_COUNT(GoldenFrames), 15, 14);
+
+        TestEqual(TEXT("Forward vector after arrival"), Steerable.GetForwardVector(), FVector(.832f, .555f, 0.f), .001f);
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVAlignBehaviorTest, "SteeringSystem.Behaviors.Align", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVAlignBehaviorTest::RunTest(const FString& Parameters)
+{
+    using namespace VSteeringBehaviorTests;
+
+    FVMockSteerable Steerable;
+    Steerable.AddSteeringBehavior(FPSSteeringBehavior( new FAlignBehavior(FSteeringTarget(FRotator(0.f, 90.f, 0.f))) ));
+
+    int32 DoneFrame = INDEX_NONE;
+
+    // Mock steerable does not turn in place, script its orientation 10 degrees towards the target each frame
+    for (int32 Frame=0; Frame<12; ++Frame)
+    {
+        Steerable.Orientation = FRotator(0.f, FMath::Min(Frame*10.f, 90.f), 0.f).Quaternion();
+        Steerable.Update(DeltaTime);
+
+        if (DoneFrame == INDEX_NONE && Steerable.GetBehaviorCount() == 0)
+        {
+            DoneFrame = Frame;
+        }
+
+        if (Frame == 0)
+        {
+            TestEqual(TEXT("Align control input"), Steerable.ControlInput.Linear, FVector(0.f, 1.f, 0.f), .001f);
+            TestFalse(TEXT("Align enables acceleration"), Steerable.ControlInput.bEnableAcceleration);
+        }
+    }
+
+    TestEqual(TEXT("Align done frame"), DoneFrame, 9);
+    TestEqual(TEXT("Location after align"), Steerable.Location, FVector::ZeroVector, GoldenTolerance);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRepulsionBehaviorTest, "SteeringSystem.Behaviors.Repulsion", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVRepulsionBehaviorTest::RunTest(const FString& Parameters)
+{
+    using namespace VSteeringBehaviorTests;
+
+    static const FGoldenFrame GoldenFrames[] = {
+        { 1, FVector( 66.f,  88.f, 0.f) },
+        { 2, FVector(102.f, 136.f, 0.f) },
+        { 3, FVector(138.f, 184.f, 0.f) },
+        { 5, FVector(138.f, 184.f, 0.f) }
+    };
+
+    FVMockSteerable Steerable;
+    Steerable.Location = FVector(30.f, 40.f, 0.f);
+    Steerable.AddSteeringBehavior(FPSSteeringBehavior( new FRepulsionBehavior(FVector::ZeroVector, 200.f) ));
+
+    RunTrajectory(*this, Steerable, GoldenFrames, ARRAY_COUNT(GoldenFrames), 5, 4);
+
+    // Repulsion locks orientation
+    TestEqual(TEXT("Forward vector after repulsion"), Steerable.GetForwardVector(), FVector::ForwardVector, .001f);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVLineRepulsionBehaviorTest, "SteeringSystem.Behaviors.LineRepulsion", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVLineRepulsionBehaviorTest::RunTest(const FString& Parameters)
+{
+    using namespace VSteeringBehaviorTests;
+
+    // Steerable off the line, repelled perpendicular to the line
+    {
+        static const FGoldenFrame GoldenFrames[] = {
+            { 1, FVector(100.f, 110.f, 0.f) },
+            { 2, FVector(100.f, 170.f, 0.f) },
+            { 3, FVector(100.f, 230.f, 0.f) },
+            { 5, FVector(100.f, 230.f, 0.f) }
+        };
+
+        FVMockSteerable Steerable;
+        Steerable.Location = FVector(100.f, 50.f, 0.f);
+        Steerable.AddSteeringBehavior(FPSSteeringBehavior( new FLineRepulsionBehavior(FVector::ZeroVector, FVector::ForwardVector, 200.f, -FVector::RightVector) ));
+
+        RunTrajectory(*this, Steerable, GoldenFrames, ARRAY_COUNT(GoldenFrames), 5, 4);
+    }
+
+    // Steerable on the line, repelled towards parallel repulsion direction
+    {
+        static const FGoldenFrame GoldenFrames[] = {
+            { 1, FVector(100.f,  -60.f, 0.f) },
+            { 2, FVector(100.f, -120.f, 0.f) },
+            { 4, FVector(100.f, -240.f, 0.f) },
+            { 6, FVector(100.f, -240.f, 0.f) }
+        };
+
+        FVMockSteerable Steerable;
+        Steerable.Location = FVector(100.f, 0.f, 0.f);
+        Steerable.AddSteeringBehavior(FPSSteeringBehavior( new FLineRepulsionBehavior(FVector::ZeroVector, FVector::ForwardVector, 200.f, -FVector::RightVector) ));
+
+        RunTrajectory(*this, Steerable, GoldenFrames, ARRAY_COUNT(GoldenFrames), 6, 5);
+    }
+
+    return true;
+}
+
+#endif // WITH_EDITOR && WITH_DEV_AUTOMATION_TESTS
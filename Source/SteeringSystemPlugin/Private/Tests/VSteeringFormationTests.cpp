@@ -0,0 +1,204 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+// 
+
+
+#include "Misc/AutomationTest.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "VMockSteerable.h"
+#include "SteeringFormation.h"
+#include "Behaviors/MoveFormationBehavior.h"
+
+#if WITH_EDITOR && WITH_DEV_AUTOMATION_TESTS
+
+namespace VSteeringFormationTests
+{
+    static const float DeltaTime = .1f;
+    static const float GoldenTolerance = .1f;
+
+    // Golden frames are mock trajectories, run with -VSteeringLogGoldens to log them, see VSteeringBehaviorTests.cpp
+    static bool ShouldLogGoldens()
+    {
+        return FParse::Param(FCommandLine::Get(), TEXT("VSteeringLogGoldens"));
+    }
+
+    // Expected formation state after the specified frame update
+    struct FGoldenFrame
+    {
+        int32 Frame;
+        FVector AnchorLocation;
+        FVector PrimaryLocation;
+        FVector MemberLocation;
+        float VelocityLimit;
+    };
+
+    static void TestSlotLocation(FAutomationTestBase& Test, FSteeringFormation& Formation, FVMockSteerable& Member, const FVector& Expected, const TCHAR* What)
+    {
+        FVector SlotLocation(ForceInitToZero);
+        Formation.CalculateSlotLocation(&Member, SlotLocation);
+        Test.TestEqual(What, SlotLocation, Expected, GoldenTolerance);
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVSteeringFormationSlotTest, "SteeringSystem.Formation.Slots", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVSteeringFormationSlotTest::RunTest(const FString& Parameters)
+{
+    using namespace VSteeringFormationTests;
+
+    // Proxy is declared first, members detach from the formation on destruction
+    FVMockFormationProxy Proxy;
+    FVMockSteerable Members[3];
+
+    FSteeringFormation& Formation(Proxy.GetFormation());
+    Proxy.SetAnchorLocation(FVector(100.f, 200.f, 0.f));
+
+    for (int32 i=0; i<ARRAY_COUNT(Members); ++i)
+    {
+        Members[i].SetFormation(&Formation, i == 0);
+    }
+
+    Proxy.Update(DeltaTime);
+
+    TestTrue(TEXT("Primary is the first member"), Formation.GetPrimary() == &Members[0]);
+    TestTrue(TEXT("Slot revision after pattern update"), Formation.GetSlotRevision() == 1);
+
+    // Two full slots on the first row, odd slot centered on the second row, spaced by member outer radius
+    TestSlotLocation(*this, Formation, Members[0], FVector(100.f, 200.f, 0.f), TEXT("Slot 0"));
+    TestSlotLocation(*this, Formation, Members[1], FVector(100.f, 350.f, 0.f), TEXT("Slot 1"));
+    TestSlotLocation(*this, Formation, Members[2], FVector(250.f, 275.f, 0.f), TEXT("Slot 2"));
+
+    // Slot offsets follow formation orientation
+    Formation.SetOrientation(FRotator(0.f, 90.f, 0.f).Quaternion());
+
+    TestSlotLocation(*this, Formation, Members[1], FVector(-50.f, 200.f, 0.f), TEXT("Rotated slot 1"));
+    TestSlotLocation(*this, Formation, Members[2], FVector( 25.f, 350.f, 0.f), TEXT("Rotated slot 2"));
+
+    // Removing a member rebuilds pattern and slots on the next update
+    Formation.SetOrientation(FQuat::Identity);
+    Members[1].SetFormation(nullptr);
+
+    TestTrue(TEXT("Pattern update required after member removal"), Formation.IsPatternUpdateRequired());
+
+    Proxy.Update(DeltaTime);
+
+    TestTrue(TEXT("Slot revision after member removal"), Formation.GetSlotRevision() == 2);
+    TestSlotLocation(*this, Formation, Members[0], FVector(100.f, 200.f, 0.f), TEXT("Slot 0 after removal"));
+    TestSlotLocation(*this, Formation, Members[2], FVector(100.f, 350.f, 0.f), TEXT("Slot 1 after removal"));
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVFormationFollowBehaviorTest, "SteeringSystem.Formation.FollowBehavior", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVFormationFollowBehaviorTest::RunTest(const FString& Parameters)
+{
+    using namespace VSteeringFormationTests;
+
+    // Anchor accelerates towards the target while members follow their slots through FFormationFollowBehavior
+    static const FGoldenFrame GoldenFrames[] = {
+        {  2, FVector(   6.000f, 0.f, 0.f), FVector(   6.000f, 0.f, 0.f), FVector(   6.000f, 150.f, 0.f),  60.000f },
+        {  5, FVector(  54.294f, 0.f, 0.f), FVector(  54.294f, 0.f, 0.f), FVector(  54.294f, 150.f, 0.f), 206.340f },
+        { 10, FVector( 209.207f, 0.f, 0.f), FVector( 209.207f, 0.f, 0.f), FVector( 209.207f, 150.f, 0.f), 367.548f },
+        { 20, FVector( 672.946f, 0.f, 0.f), FVector( 681.952f, 0.f, 0.f), FVector( 681.952f, 150.f, 0.f), 518.949f },
+        { 30, FVector(1225.435f, 0.f, 0.f), FVector(1234.440f, 0.f, 0.f), FVector(1234.440f, 150.f, 0.f), 571.739f },
+        { 40, FVector(1808.869f, 0.f, 0.f), FVector(1818.860f, 0.f, 0.f), FVector(1818.860f, 150.f, 0.f), 590.146f },
+        { 43, FVector(1986.465f, 0.f, 0.f), FVector(1996.456f, 0.f, 0.f), FVector(1996.456f, 150.f, 0.f), 592.817f },
+        { 44, FVector(2000.000f, 0.f, 0.f), FVector(1996.456f, 0.f, 0.f), FVector(1996.456f, 150.f, 0.f), 593.535f },
+        { 45, FVector(2000.000f, 0.f, 0.f), FVector(1996.456f, 0.f, 0.f), FVector(1996.456f, 150.f, 0.f),   0.000f }
+    };
+
+    FVMockFormationProxy Proxy;
+    FVMockSteerable Primary;
+    FVMockSteerable Member;
+
+    FSteeringFormation& Formation(Proxy.GetFormation());
+
+    Member.Location = FVector(0.f, 150.f, 0.f);
+    Primary.SetFormation(&Formation, true);
+    Member.SetFormation(&Formation);
+
+    Proxy.AddFormationBehavior(FPSFormationBehavior( new FMoveFormationBehavior(FSteeringTarget(FVector(2000.f, 0.f, 0.f))) ));
+
+    int32 FormationDoneFrame = INDEX_NONE;
+    int32 MemberDoneFrame = INDEX_NONE;
+    int32 GoldenIndex = 0;
+
+    // Formation is updated before its members, as with formation tick prerequisites
+    for (int32 Frame=1; Frame<=50; ++Frame)
+    {
+        Proxy.Update(DeltaTime);
+        Primary.Update(DeltaTime);
+        Member.Update(DeltaTime);
+
+        if (Frame == 1)
+        {
+            TestEqual(TEXT("Primary follow behavior assigned"), Primary.GetBehaviorCount(), 1);
+            TestEqual(TEXT("Member follow behavior assigned"), Member.GetBehaviorCount(), 1);
+        }
+
+        if (MemberDoneFrame == INDEX_NONE && Primary.GetBehaviorCount() == 0 && Member.GetBehaviorCount() == 0)
+        {
+            MemberDoneFrame = Frame;
+        }
+
+        if (FormationDoneFrame == INDEX_NONE && ! Formation.GetActiveBehavior())
+        {
+            FormationDoneFrame = Frame;
+        }
+
+        if (ShouldLogGoldens())
+        {
+            const FVector AnchorLocation(Formation.GetAnchorLocation());
+            AddInfo(FString::Printf(TEXT("{ %2d, FVector(%.3ff, %.3ff, %.3ff), FVector(%.3ff, %.3ff, %.3ff), FVector(%.3ff, %.3ff, %.3ff), %.3ff },"),
+                Frame,
+                AnchorLocation.X, AnchorLocation.Y, AnchorLocation.Z,
+                Primary.Location.X, Primary.Location.Y, Primary.Location.Z,
+                Member.Location.X, Member.Location.Y, Member.Location.Z,
+                Formation.GetVelocityLimit()));
+        }
+
+        if (GoldenIndex < ARRAY_COUNT(GoldenFrames) && GoldenFrames[GoldenIndex].Frame == Frame)
+        {
+            const FGoldenFrame& Golden(GoldenFrames[GoldenIndex]);
+
+            TestEqual(*FString::Printf(TEXT("Anchor location at frame %d"), Frame), Formation.GetAnchorLocation(), Golden.AnchorLocation, GoldenTolerance);
+            TestEqual(*FString::Printf(TEXT("Primary location at frame %d"), Frame), Primary.Location, Golden.PrimaryLocation, GoldenTolerance);
+            TestEqual(*FString::Printf(TEXT("Member location at frame %d"), Frame), Member.Location, Golden.MemberLocation, GoldenTolerance);
+            TestEqual(*FString::Printf(TEXT("Velocity limit at frame %d"), Frame), Formation.GetVelocityLimit(), Golden.VelocityLimit, GoldenTolerance);
+
+            ++GoldenIndex;
+        }
+    }
+
+    TestEqual(TEXT("Member follow behaviors done frame"), MemberDoneFrame, 44);
+    TestEqual(TEXT("Move formation behavior done frame"), FormationDoneFrame, 45);
+
+    return true;
+}
+
+#endif // WITH_EDITOR && WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,411 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+// 
+
+#include "VAnalyticMovementComponent.h"
+#include "VSmoothDeltaActor.h"
+#include "Curves/CurveVector.h"
+#include "Net/UnrealNetwork.h"
+
+const int32 UVAnalyticMovementComponent::PATH_LENGTH_SEGMENTS = 32;
+
+// ~ UVAnalyticMovementComponent
+
+UVAnalyticMovementComponent::UVAnalyticMovementComponent(const FObjectInitializer& ObjectInitializer)
+    : Super(ObjectInitializer)
+{
+    bOrientToMovement = true;
+    bSweepMovement = true;
+
+    OriginTransform = FTransform::Identity;
+    bHasOrigin = false;
+    PathLength = 0.f;
+}
+
+void UVAnalyticMovementComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+    Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+    DOREPLIFETIME_CONDITION(UVAnalyticMovementComponent, OriginTransform, COND_SimulatedOnly);
+}
+
+void UVAnalyticMovementComponent::InitializeComponent()
+{
+    Super::InitializeComponent();
+
+    // Path origin is replicated through this component
+    SetIsReplicated(true);
+}
+
+void UVAnalyticMovementComponent::BeginPlay()
+{
+    // Capture path frame before any movement update.
+    // Simulated proxies use their own transform until the server origin is received.
+    if (! bHasOrigin && UpdatedComponent)
+    {
+        OriginTransform = UpdatedComponent->GetComponentTransform();
+        bHasOrigin = GetOwnerRole() == ROLE_Authority;
+    }
+
+    UpdatePath();
+
+    Super::BeginPlay();
+}
+
+void UVAnalyticMovementComponent::OnRep_OriginTransform()
+{
+    bHasOrigin = true;
+    UpdatePath();
+}
+
+void UVAnalyticMovementComponent::MovementSourceChange()
+{
+    UpdatePath();
+
+    Super::MovementSourceChange();
+}
+
+void UVAnalyticMovementComponent::UpdatePath()
+{
+    const FVector FrameScale = GetPathFrame().GetScale3D().GetAbs();
+    const float MaxScale = FrameScale.GetMax();
+
+    FVector Tangent;
+    FVector LastLocation;
+    EvaluatePath(0.f, LastLocation, Tangent);
+
+    float LocalLength = 0.f;
+
+    for (int32 i=1; i<=PATH_LENGTH_SEGMENTS; ++i)
+    {
+        FVector Location;
+        EvaluatePath(float(i) / PATH_LENGTH_SEGMENTS, Location, Tangent);
+
+        LocalLength += FVector::Dist(LastLocation, Location);
+        LastLocation = Location;
+    }
+
+    PathLength = LocalLength * MaxScale;
+}
+
+void UVAnalyticMovementComponent::EvaluatePath(float Alpha, FVector& OutLocation, FVector& OutTangent) const
+{
+    // Blank implementation, intended for derived classes to override.
+    OutLocation = FVector::ZeroVector;
+    OutTangent = FVector::ZeroVector;
+}
+
+FTransform UVAnalyticMovementComponent::GetPathFrame() const
+{
+    const UPrimitiveComponent* MovementSource = SDOwner ? SDOwner->GetMovementSource() : nullptr;
+
+    if (MovementSource)
+    {
+        return MovementSource->GetComponentTransform();
+    }
+
+    return OriginTransform;
+}
+
+FTransform UVAnalyticMovementComponent::GetTransformAtTime(float InSimulationTime) const
+{
+    if (! HasValidPath())
+    {
+        return GetPathFrame();
+    }
+
+    const float Alpha = FMath::Clamp(InSimulationTime / Duration, 0.f, 1.f);
+    const FTransform Frame = GetPathFrame();
+
+    FVector Location;
+    FVector Tangent;
+    EvaluatePath(Alpha, Location, Tangent);
+
+    FQuat Rotation = Frame.GetRotation();
+
+    if (bOrientToMovement)
+    {
+        const FVector WorldTangent = Frame.TransformVectorNoScale(Tangent);
+
+        if (! WorldTangent.IsNearlyZero())
+        {
+            Rotation = FRotationMatrix::MakeFromXZ(WorldTangent, Frame.GetUnitAxis(EAxis::Z)).ToQuat();
+        }
+        else if (UpdatedComponent)
+        {
+            // Keep current rotation on stationary path points
+            Rotation = UpdatedComponent->GetComponentQuat();
+        }
+    }
+
+    return FTransform(Rotation, Frame.TransformPosition(Location));
+}
+
+void UVAnalyticMovementComponent::MovementUpdate(float DeltaTime)
+{
+    // Perform movement update with impact handling
+    MovementUpdateImpl(DeltaTime, true);
+}
+
+void UVAnalyticMovementComponent::MovementUpdateImpl(float DeltaTime, bool bHandleImpact)
+{
+    check(HasValidData());
+
+    // No valid path simulation data, abort
+    if (! HasValidPath())
+    {
+        return;
+    }
+
+    bJustTeleported = false;
+
+    const FVector OldLocation = UpdatedComponent->GetComponentLocation();
+    const FTransform NewTransform = GetTransformAtTime(CurrentSimulationTime);
+    const FVector DeltaLocation = NewTransform.GetLocation() - OldLocation;
+
+    if (bSweepMovement)
+    {
+        FHitResult Hit(1.f);
+        SafeMoveUpdatedComponent(DeltaLocation, NewTransform.GetRotation(), true, Hit);
+
+        if (bHandleImpact && Hit.Time < 1.f)
+        {
+            HandleImpact(Hit, DeltaTime, DeltaLocation);
+        }
+    }
+    else
+    {
+        MoveUpdatedComponent(DeltaLocation, NewTransform.GetRotation(), false, nullptr, ETeleportType::TeleportPhysics);
+    }
+
+    if (!bJustTeleported)
+    {
+        Velocity = (UpdatedComponent->GetComponentLocation() - OldLocation) / DeltaTime;
+    }
+}
+
+void UVAnalyticMovementComponent::MoveSmooth(float DeltaTime)
+{
+    // Perform movement update without handling hit impact on client proxies
+    MovementUpdateImpl(DeltaTime, false);
+}
+
+void UVAnalyticMovementComponent::MoveSmooth_Visual()
+{
+    check(HasValidData());
+
+    // No valid simulation data, abort
+    if (! HasValidPath())
+    {
+        return;
+    }
+
+    // Only exponential smoothing is supported, see USplineFollowingMovementComponent::MoveSmooth_Visual()
+    if (NetworkSmoothingMode == ENetworkSmoothingMode::Exponential)
+    {
+        float OffsetTime = CurrentSimulationTime + SmoothSimulationOffset;
+
+        if (OffsetTime > 0.f)
+        {
+            OffsetTime = GetClampedSimulationTime(OffsetTime);
+        }
+        else
+        {
+            OffsetTime = GetClampedSimulationTime(Duration+OffsetTime);
+        }
+
+        SDOwner->GetMeshRoot()->SetWorldTransform(GetTransformAtTime(OffsetTime));
+    }
+}
+
+void UVAnalyticMovementComponent::SnapToCurrentTime()
+{
+    check(HasValidData());
+
+    // No valid path simulation data, abort
+    if (! HasValidPath())
+    {
+        return;
+    }
+
+    UpdatedComponent->SetWorldTransform(GetTransformAtTime(CurrentSimulationTime));
+
+    bJustTeleported = true;
+}
+
+float UVAnalyticMovementComponent::GetClampedSmoothSimulationOffset(float InSimulationTimeDelta) const
+{
+    if (HasValidPath() && PathLength > 0.f)
+    {
+        const float TimePerDistance = Duration / PathLength;
+        const float AbsSmoothDelta = FMath::Abs(InSimulationTimeDelta);
+        const float MaxSmoothDelta = NetworkMaxSmoothUpdateDistance * TimePerDistance;
+
+        if (AbsSmoothDelta < MaxSmoothDelta)
+        {
+            return InSimulationTimeDelta;
+        }
+        else
+        {
+            const float SmoothDeltaSign = InSimulationTimeDelta>0.f ? 1.f : -1.f;
+            const float NoSmoothDelta = NetworkNoSmoothUpdateDistance * TimePerDistance;
+            return (AbsSmoothDelta < NoSmoothDelta) ? (MaxSmoothDelta*SmoothDeltaSign) : 0.f;
+        }
+    }
+
+    // Invalid required data, return zero offset
+    return 0.f;
+}
+
+// ~ UVOrbitMovementComponent
+
+UVOrbitMovementComponent::UVOrbitMovementComponent(const FObjectInitializer& ObjectInitializer)
+    : Super(ObjectInitializer)
+{
+    Radius = 500.f;
+    StartAngle = 0.f;
+    Revolutions = 1;
+}
+
+void UVOrbitMovementComponent::EvaluatePath(float Alpha, FVector& OutLocation, FVector& OutTangent) const
+{
+    const float Angle = FMath::DegreesToRadians(StartAngle) + (2.f * PI * Revolutions * Alpha);
+    const float Direction = (Revolutions < 0) ? -1.f : 1.f;
+
+    float Sin, Cos;
+    FMath::SinCos(&Sin, &Cos, Angle);
+
+    OutLocation = FVector(Cos * Radius, Sin * Radius, 0.f);
+    OutTangent = FVector(-Sin * Direction, Cos * Direction, 0.f);
+}
+
+// ~ UVPingPongMovementComponent
+
+UVPingPongMovementComponent::UVPingPongMovementComponent(const FObjectInitializer& ObjectInitializer)
+    : Super(ObjectInitializer)
+{
+    StartLocation = FVector::ZeroVector;
+    EndLocation = FVector(0.f, 0.f, 300.f);
+    bEaseInOut = true;
+    bOrientToMovement = false;
+}
+
+void UVPingPongMovementComponent::EvaluatePath(float Alpha, FVector& OutLocation, FVector& OutTangent) const
+{
+    // Forward on the first half cycle, backward on the second
+    const bool bForward = Alpha < .5f;
+    const float LinearAlpha = bForward ? (Alpha * 2.f) : (2.f - Alpha * 2.f);
+    const float PathAlpha = bEaseInOut ? FMath::SmoothStep(0.f, 1.f, LinearAlpha) : LinearAlpha;
+
+    OutLocation = FMath::Lerp(StartLocation, EndLocation, PathAlpha);
+    OutTangent = bForward ? (EndLocation - StartLocation) : (StartLocation - EndLocation);
+}
+
+// ~ UVBezierMovementComponent
+
+UVBezierMovementComponent::UVBezierMovementComponent(const FObjectInitializer& ObjectInitializer)
+    : Super(ObjectInitializer)
+{
+    StartPoint = FVector(0.f, 0.f, 0.f);
+    StartControlPoint = FVector(300.f, 300.f, 0.f);
+    EndControlPoint = FVector(600.f, -300.f, 0.f);
+    EndPoint = FVector(900.f, 0.f, 0.f);
+}
+
+void UVBezierMovementComponent::EvaluatePath(float Alpha, FVector& OutLocation, FVector& OutTangent) const
+{
+    const FVector& P0(StartPoint);
+    const FVector& P1(StartControlPoint);
+    const FVector& P2(EndControlPoint);
+    const FVector& P3(EndPoint);
+
+    const float T = Alpha;
+    const float U = 1.f - T;
+
+    // Cubic bezier position and first derivative in bernstein form
+    OutLocation = (U*U*U) * P0 + (3.f*U*U*T) * P1 + (3.f*U*T*T) * P2 + (T*T*T) * P3;
+    OutTangent = (3.f*U*U) * (P1-P0) + (6.f*U*T) * (P2-P1) + (3.f*T*T) * (P3-P2);
+}
+
+// ~ UVCurveMovementComponent
+
+UVCurveMovementComponent::UVCurveMovementComponent(const FObjectInitializer& ObjectInitializer)
+    : Super(ObjectInitializer)
+{
+    LocationCurve = nullptr;
+    SampleCount = 64;
+}
+
+void UVCurveMovementComponent::SetLocationCurve(UCurveVector* InLocationCurve)
+{
+    LocationCurve = InLocationCurve;
+    UpdatePath();
+}
+
+void UVCurveMovementComponent::UpdatePath()
+{
+    Samples.Reset();
+
+    if (LocationCurve)
+    {
+        const int32 SampleNum = FMath::Max(2, SampleCount);
+
+        float MinTime, MaxTime;
+        LocationCurve->GetTimeRange(MinTime, MaxTime);
+
+        Samples.SetNumUninitialized(SampleNum);
+
+        for (int32 i=0; i<SampleNum; ++i)
+        {
+            const float SampleAlpha = float(i) / (SampleNum-1);
+            Samples[i] = LocationCurve->GetVectorValue(FMath::Lerp(MinTime, MaxTime, SampleAlpha));
+        }
+    }
+
+    Super::UpdatePath();
+}
+
+void UVCurveMovementComponent::EvaluatePath(float Alpha, FVector& OutLocation, FVector& OutTangent) const
+{
+    const int32 SampleNum = Samples.Num();
+
+    if (SampleNum < 2)
+    {
+        OutLocation = FVector::ZeroVector;
+        OutTangent = FVector::ZeroVector;
+        return;
+    }
+
+    const float SampleTime = FMath::Clamp(Alpha, 0.f, 1.f) * (SampleNum-1);
+    const int32 Index = FMath::Min(FMath::FloorToInt(SampleTime), SampleNum-2);
+    const float SampleAlpha = SampleTime - Index;
+
+    const FVector& Sample0(Samples[Index]);
+    const FVector& Sample1(Samples[Index+1]);
+
+    OutLocation = FMath::Lerp(Sample0, Sample1, SampleAlpha);
+    OutTangent = Sample1 - Sample0;
+}
@@ -0,0 +1,116 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+// 
+
+#include "VAvoidanceSchedule.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Avoidance Solves"), STAT_VAvoidanceSolves, STATGROUP_Steering);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Avoidance Solves Skipped"), STAT_VAvoidanceSolvesSkipped, STATGROUP_Steering);
+
+namespace VAvoidanceCVars
+{
+    static int32 Throttle = 1;
+    FAutoConsoleVariableRef CVarThrottle(
+        TEXT("p.VAvoidanceThrottle"),
+        Throttle,
+        TEXT("Whether RVO avoidance is solved at an adaptive interval instead of every tick.\n")
+        TEXT("0: Disable, 1: Enable"),
+        ECVF_Default);
+
+    static float MinInterval = 0.f;
+    FAutoConsoleVariableRef CVarMinInterval(
+        TEXT("p.VAvoidanceMinInterval"),
+        MinInterval,
+        TEXT("Avoidance solve interval in seconds of agents in crowded or fast changing neighborhoods."),
+        ECVF_Default);
+
+    static float MaxInterval = 0.25f;
+    FAutoConsoleVariableRef CVarMaxInterval(
+        TEXT("p.VAvoidanceMaxInterval"),
+        MaxInterval,
+        TEXT("Avoidance solve interval in seconds of agents without nearby conflicts."),
+        ECVF_Default);
+
+    static float Sensitivity = 4.f;
+    FAutoConsoleVariableRef CVarSensitivity(
+        TEXT("p.VAvoidanceSensitivity"),
+        Sensitivity,
+        TEXT("Scale of normalized avoidance deviation and change at which the minimum interval is reached."),
+        ECVF_Default);
+}
+
+bool FVAvoidanceSchedule::IsEnabled()
+{
+    return VAvoidanceCVars::Throttle != 0;
+}
+
+bool FVAvoidanceSchedule::ShouldUpdate(float WorldTime) const
+{
+    if (! IsEnabled() || WorldTime >= NextUpdateTime)
+    {
+        INC_DWORD_STAT(STAT_VAvoidanceSolves);
+        return true;
+    }
+
+    INC_DWORD_STAT(STAT_VAvoidanceSolvesSkipped);
+    return false;
+}
+
+float FVAvoidanceSchedule::Schedule(float WorldTime, const FVector& PreferredVelocity, const FVector& AvoidanceVelocity, float MaxSpeed)
+{
+    if (IsEnabled())
+    {
+        const float InvMaxSpeed = (MaxSpeed > 0.f) ? (1.f / MaxSpeed) : 0.f;
+
+        // Deviation from preferred velocity grows with the number of neighbors the solver has to avoid
+        const float Deviation = (AvoidanceVelocity - PreferredVelocity).Size() * InvMaxSpeed;
+
+        // Change since the last solve grows with relative closing speed of neighbors
+        const float Change = (AvoidanceVelocity - LastAvoidanceVelocity).Size() * InvMaxSpeed;
+
+        const float Urgency = FMath::Clamp(FMath::Max(Deviation, Change) * VAvoidanceCVars::Sensitivity, 0.f, 1.f);
+        const float MinInterval = FMath::Max(VAvoidanceCVars::MinInterval, 0.f);
+        const float MaxInterval = FMath::Max(VAvoidanceCVars::MaxInterval, MinInterval);
+
+        UpdateInterval = FMath::Lerp(MaxInterval, MinInterval, Urgency);
+    }
+    else
+    {
+        UpdateInterval = 0.f;
+    }
+
+    NextUpdateTime = WorldTime + UpdateInterval;
+    LastAvoidanceVelocity = AvoidanceVelocity;
+
+    return UpdateInterval;
+}
+
+void FVAvoidanceSchedule::Reset()
+{
+    NextUpdateTime = 0.f;
+    UpdateInterval = 0.f;
+    LastAvoidanceVelocity = FVector::ZeroVector;
+}
@@ -0,0 +1,233 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+// 
+
+#include "VBakedSplineCache.h"
+#include "Components/SplineComponent.h"
+
+DECLARE_CYCLE_STAT(TEXT("Bake Spline"), STAT_VBakedSpline_Bake, STATGROUP_Steering);
+
+namespace VBakedSplineCVars
+{
+    static float BakeSampleDistance = 50.f;
+    FAutoConsoleVariableRef CVarBakeSampleDistance(
+        TEXT("p.VBakedSplineSampleDistance"),
+        BakeSampleDistance,
+        TEXT("Arc length distance between baked spline samples used by spline followers.\n")
+        TEXT("Takes effect on splines baked after the change."),
+        ECVF_Default);
+
+    static int32 BakeMaxSampleCount = 65536;
+    FAutoConsoleVariableRef CVarBakeMaxSampleCount(
+        TEXT("p.VBakedSplineMaxSampleCount"),
+        BakeMaxSampleCount,
+        TEXT("Maximum number of samples of a single baked spline. Sample distance is increased on longer splines."),
+        ECVF_Default);
+}
+
+// ~ FVBakedSpline
+
+FVBakedSpline::FVBakedSpline(const USplineComponent& Spline, float SampleDistance)
+    : SplineLength(Spline.GetSplineLength())
+    , SplineDuration(Spline.Duration)
+    , TimeToSample(0.f)
+    , Version(Spline.SplineCurves.Version)
+{
+    SCOPE_CYCLE_COUNTER(STAT_VBakedSpline_Bake);
+
+    const int32 MaxSampleCount = FMath::Max(VBakedSplineCVars::BakeMaxSampleCount, 2);
+    const int32 SampleCount = FMath::Clamp(FMath::CeilToInt(SplineLength / FMath::Max(SampleDistance, 1.f)) + 1, 2, MaxSampleCount);
+    const float SampleStep = SplineLength / (SampleCount-1);
+
+    Locations.SetNumUninitialized(SampleCount);
+    Rotations.SetNumUninitialized(SampleCount);
+
+    for (int32 i=0; i<SampleCount; ++i)
+    {
+        const float Distance = i * SampleStep;
+        Locations[i] = Spline.GetLocationAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::Local);
+        Rotations[i] = Spline.GetQuaternionAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::Local);
+    }
+
+    // Time to sample index scale, constant velocity maps time linearly to arc length
+    TimeToSample = (SplineDuration > 0.f) ? ((SampleCount-1) / SplineDuration) : 0.f;
+}
+
+FVector FVBakedSpline::GetLocationAtTime(float SplineTime) const
+{
+    int32 Index;
+    float Alpha;
+    GetSampleIndex(SplineTime, Index, Alpha);
+
+    return FMath::Lerp(Locations[Index], Locations[Index+1], Alpha);
+}
+
+FQuat FVBakedSpline::GetQuaternionAtTime(float SplineTime) const
+{
+    int32 Index;
+    float Alpha;
+    GetSampleIndex(SplineTime, Index, Alpha);
+
+    return FQuat::FastLerp(Rotations[Index], Rotations[Index+1], Alpha).GetNormalized();
+}
+
+FTransform FVBakedSpline::GetTransformAtTime(float SplineTime) const
+{
+    int32 Index;
+    float Alpha;
+    GetSampleIndex(SplineTime, Index, Alpha);
+
+    return FTransform(
+        FQuat::FastLerp(Rotations[Index], Rotations[Index+1], Alpha).GetNormalized(),
+        FMath::Lerp(Locations[Index], Locations[Index+1], Alpha)
+        );
+}
+
+void FVBakedSpline::GetWorldTransformsAtTimes(const FTransform& SplineTransform, const float* SplineTimes, int32 Count, FVector* OutLocations, FQuat* OutRotations) const
+{
+    check(SplineTimes && OutLocations && OutRotations);
+
+    const FQuat SplineQuat(SplineTransform.GetRotation());
+    const FVector SplineScale(SplineTransform.GetScale3D());
+    const FVector SplineTranslation(SplineTransform.GetTranslation());
+    const VectorRegister SplineRotation = VectorLoad(&SplineQuat);
+    const VectorRegister VSplineScale = VectorLoadFloat3_W0(&SplineScale);
+    const VectorRegister VSplineTranslation = VectorLoadFloat3_W0(&SplineTranslation);
+
+    for (int32 i=0; i<Count; ++i)
+    {
+        int32 Index;
+        float Alpha;
+        GetSampleIndex(SplineTimes[i], Index, Alpha);
+
+        const VectorRegister VAlpha = VectorLoadFloat1(&Alpha);
+
+        // Location lerp and world space conversion, see FTransform::TransformPosition()
+        const VectorRegister LA = VectorLoadFloat3_W0(&Locations[Index]);
+        const VectorRegister LB = VectorLoadFloat3_W0(&Locations[Index+1]);
+        const VectorRegister Location = VectorMultiplyAdd(VectorSubtract(LB, LA), VAlpha, LA);
+        const VectorRegister WorldLocation = VectorAdd(VectorQuaternionRotateVector(SplineRotation, VectorMultiply(Location, VSplineScale)), VSplineTranslation);
+
+        VectorStoreFloat3(WorldLocation, &OutLocations[i]);
+
+        // Rotation fast lerp with shortest path bias, see FQuat::FastLerp()
+        const VectorRegister A = VectorLoad(&Rotations[Index]);
+        const VectorRegister B = VectorLoad(&Rotations[Index+1]);
+        const VectorRegister Bias = VectorSelect(
+            VectorCompareGE(VectorDot4(A, B), GlobalVectorConstants::FloatZero),
+            GlobalVectorConstants::FloatOne,
+            GlobalVectorConstants::FloatMinusOne
+            );
+        const VectorRegister AWeight = VectorMultiply(Bias, VectorSubtract(GlobalVectorConstants::FloatOne, VAlpha));
+        const VectorRegister Rotation = VectorNormalizeQuaternion(VectorMultiplyAdd(B, VAlpha, VectorMultiply(A, AWeight)));
+
+        VectorStore(VectorQuaternionMultiply2(SplineRotation, Rotation), &OutRotations[i]);
+    }
+}
+
+// ~ FVBakedSplineCache
+
+TMap<const USplineComponent*, FVBakedSplineCache::FEntry> FVBakedSplineCache::Entries;
+
+FPSBakedSpline FVBakedSplineCache::GetBakedSpline(const USplineComponent* Spline)
+{
+    check(IsInGameThread());
+
+    if (! IsValid(Spline))
+    {
+        return nullptr;
+    }
+
+    FEntry* Entry = Entries.Find(Spline);
+
+    // Reuse cached entry if still valid and up to date.
+    // Spline pointer might have been reused by a new object, validate with weak pointer.
+    if (Entry && Entry->Spline.Get() == Spline && ! IsOutdated(*Entry->BakedSpline, *Spline))
+    {
+        return Entry->BakedSpline;
+    }
+
+    // Entry will be added, clean up stale entries
+    if (! Entry)
+    {
+        PurgeStaleEntries();
+    }
+
+    FEntry& NewEntry(Entries.FindOrAdd(Spline));
+    NewEntry.Spline = Spline;
+    NewEntry.BakedSpline = MakeShareable(new FVBakedSpline(*Spline, VBakedSplineCVars::BakeSampleDistance));
+
+    return NewEntry.BakedSpline;
+}
+
+bool FVBakedSplineCache::IsOutdated(const FVBakedSpline& BakedSpline, const USplineComponent& Spline)
+{
+    return BakedSpline.GetVersion() != Spline.SplineCurves.Version || BakedSpline.GetSplineDuration() != Spline.Duration;
+}
+
+void FVBakedSplineCache::PurgeStaleEntries()
+{
+    for (auto It = Entries.CreateIterator(); It; ++It)
+    {
+        if (! It.Value().Spline.IsValid())
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
+
+void FVBakedSplineCache::PurgeWorldEntries(const UWorld* World)
+{
+    for (auto It = Entries.CreateIterator(); It; ++It)
+    {
+        const USplineComponent* Spline = It.Value().Spline.Get();
+
+        if (! Spline || Spline->GetWorld() == World)
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
+
+void FVBakedSplineCache::Clear()
+{
+    Entries.Empty();
+}
+
+SIZE_T FVBakedSplineCache::GetAllocatedSize()
+{
+    SIZE_T AllocatedSize = Entries.GetAllocatedSize();
+
+    for (const TPair<const USplineComponent*, FEntry>& Entry : Entries)
+    {
+        if (Entry.Value.BakedSpline.IsValid())
+        {
+            AllocatedSize += sizeof(FVBakedSpline) + Entry.Value.BakedSpline->GetAllocatedSize();
+        }
+    }
+
+    return AllocatedSize;
+}
@@ -0,0 +1,139 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+// 
+
+#include "VCompactRepMovement.h"
+#include "GameFramework/Actor.h"
+
+// Zigzag encoded packed signed integer serialization
+static void SerializeSignedIntPacked(FArchive& Ar, int32& Value)
+{
+    uint32 PackedValue = (static_cast<uint32>(Value) << 1) ^ static_cast<uint32>(Value >> 31);
+    Ar.SerializeIntPacked(PackedValue);
+    Value = static_cast<int32>(PackedValue >> 1) ^ -static_cast<int32>(PackedValue & 1);
+}
+
+// Serialize single location axis as cell index and quantized offset within the cell
+static void SerializeCellAxis(FArchive& Ar, float& Value, float CellSize, uint32 OffsetBits)
+{
+    const uint32 OffsetMax = (1u << OffsetBits) - 1;
+
+    int32 CellIndex = 0;
+    uint32 CellOffset = 0;
+
+    if (Ar.IsSaving())
+    {
+        CellIndex = FMath::FloorToInt(Value / CellSize);
+        const float CellAlpha = (Value - CellIndex * CellSize) / CellSize;
+        CellOffset = FMath::Clamp<uint32>(FMath::RoundToInt(CellAlpha * OffsetMax), 0, OffsetMax);
+    }
+
+    SerializeSignedIntPacked(Ar, CellIndex);
+    Ar.SerializeBits(&CellOffset, OffsetBits);
+
+    if (Ar.IsLoading())
+    {
+        Value = (CellIndex + static_cast<float>(CellOffset) / OffsetMax) * CellSize;
+    }
+}
+
+FVCompactRepMovement::FVCompactRepMovement()
+    : Location(ForceInitToZero)
+    , Yaw(0.f)
+    , ForwardSpeed(0.f)
+    , CellSize(4096.f)
+    , CellOffsetBits(12)
+    , SpeedQuantum(1.f)
+    , bCompressYawToByte(false)
+    , bReplicateZ(false)
+{
+}
+
+bool FVCompactRepMovement::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+    const float SafeCellSize = FMath::Max(CellSize, 1.f);
+    const uint32 OffsetBits = FMath::Clamp(CellOffsetBits, 4, 20);
+
+    // Location
+
+    SerializeCellAxis(Ar, Location.X, SafeCellSize, OffsetBits);
+    SerializeCellAxis(Ar, Location.Y, SafeCellSize, OffsetBits);
+
+    if (bReplicateZ)
+    {
+        int32 LocationZ = Ar.IsSaving() ? FMath::RoundToInt(Location.Z) : 0;
+        SerializeSignedIntPacked(Ar, LocationZ);
+        Location.Z = LocationZ;
+    }
+
+    // Yaw
+
+    if (bCompressYawToByte)
+    {
+        uint8 CompressedYaw = Ar.IsSaving() ? FRotator::CompressAxisToByte(Yaw) : 0;
+        Ar << CompressedYaw;
+        Yaw = FRotator::DecompressAxisFromByte(CompressedYaw);
+    }
+    else
+    {
+        uint16 CompressedYaw = Ar.IsSaving() ? FRotator::CompressAxisToShort(Yaw) : 0;
+        Ar << CompressedYaw;
+        Yaw = FRotator::DecompressAxisFromShort(CompressedYaw);
+    }
+
+    // Forward speed
+
+    const float SafeSpeedQuantum = FMath::Max(SpeedQuantum, 0.01f);
+    int32 QuantizedSpeed = Ar.IsSaving() ? FMath::RoundToInt(ForwardSpeed / SafeSpeedQuantum) : 0;
+    SerializeSignedIntPacked(Ar, QuantizedSpeed);
+    ForwardSpeed = QuantizedSpeed * SafeSpeedQuantum;
+
+    bOutSuccess = ! Ar.IsError();
+    return true;
+}
+
+void FVCompactRepMovement::SetFromRepMovement(const FRepMovement& RepMovement)
+{
+    Location = RepMovement.Location;
+    Yaw = RepMovement.Rotation.Yaw;
+    ForwardSpeed = RepMovement.LinearVelocity | FRotator(0.f, Yaw, 0.f).Vector();
+}
+
+void FVCompactRepMovement::CopyToRepMovement(FRepMovement& RepMovement, const AActor* Actor) const
+{
+    const FRotator Rotation(0.f, Yaw, 0.f);
+
+    RepMovement.Location = Location;
+    RepMovement.Rotation = Rotation;
+    RepMovement.LinearVelocity = Rotation.Vector() * ForwardSpeed;
+    RepMovement.AngularVelocity = FVector::ZeroVector;
+
+    // Keep current Z if not replicated
+    if (! bReplicateZ && Actor)
+    {
+        RepMovement.Location.Z = FRepMovement::RebaseOntoZeroOrigin(Actor->GetActorLocation(), Actor).Z;
+    }
+}
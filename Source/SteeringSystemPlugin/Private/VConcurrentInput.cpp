@@ -0,0 +1,57 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+// 
+
+#include "VConcurrentInput.h"
+#include "HAL/PlatformAtomics.h"
+
+const double FVConcurrentInputAccumulator::FixedPointScale = 16777216.0;
+
+void FVConcurrentInputAccumulator::Add(const FVector& Input)
+{
+    FPlatformAtomics::InterlockedAdd(&Components[0], ToFixed(Input.X));
+    FPlatformAtomics::InterlockedAdd(&Components[1], ToFixed(Input.Y));
+    FPlatformAtomics::InterlockedAdd(&Components[2], ToFixed(Input.Z));
+}
+
+FVector FVConcurrentInputAccumulator::Consume()
+{
+    return FVector(
+        FromFixed(FPlatformAtomics::InterlockedExchange(&Components[0], 0)),
+        FromFixed(FPlatformAtomics::InterlockedExchange(&Components[1], 0)),
+        FromFixed(FPlatformAtomics::InterlockedExchange(&Components[2], 0))
+        );
+}
+
+FVector FVConcurrentInputAccumulator::Peek() const
+{
+    // Compare exchange with equal values is an atomic read
+    return FVector(
+        FromFixed(FPlatformAtomics::InterlockedCompareExchange(&Components[0], 0, 0)),
+        FromFixed(FPlatformAtomics::InterlockedCompareExchange(&Components[1], 0, 0)),
+        FromFixed(FPlatformAtomics::InterlockedCompareExchange(&Components[2], 0, 0))
+        );
+}
@@ -0,0 +1,96 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+// 
+
+#include "VFixedTimeStep.h"
+#include "Components/SceneComponent.h"
+
+int32 FVFixedTimeStep::Advance(float DeltaTime, float StepTime, int32 MaxSteps)
+{
+    check(StepTime > 0.f);
+
+    Accumulator += FMath::Max(DeltaTime, 0.f);
+
+    int32 StepCount = FMath::FloorToInt(Accumulator / StepTime);
+
+    if (StepCount > MaxSteps)
+    {
+        StepCount = FMath::Max(MaxSteps, 0);
+        Accumulator = FMath::Fmod(Accumulator, StepTime);
+    }
+    else
+    {
+        Accumulator -= StepCount * StepTime;
+    }
+
+    InterpAlpha = FMath::Clamp(Accumulator / StepTime, 0.f, 1.f);
+
+    return StepCount;
+}
+
+void FVFixedTimeStep::SaveStepState(const USceneComponent& UpdatedComponent)
+{
+    PreviousLocation = UpdatedComponent.GetComponentLocation();
+    PreviousRotation = UpdatedComponent.GetComponentQuat();
+    bHasStepState = true;
+}
+
+void FVFixedTimeStep::ResetStepState(const USceneComponent& UpdatedComponent)
+{
+    // Accumulated time is kept, resetting it on every snap would starve fixed steps when frames are shorter than the step time
+    SaveStepState(UpdatedComponent);
+    StepLocation = PreviousLocation;
+    InterpAlpha = 1.f;
+}
+
+void FVFixedTimeStep::FinishSteps(const USceneComponent& UpdatedComponent)
+{
+    StepLocation = UpdatedComponent.GetComponentLocation();
+}
+
+bool FVFixedTimeStep::RequiresReset(const USceneComponent& UpdatedComponent) const
+{
+    return ! bHasStepState || ! UpdatedComponent.GetComponentLocation().Equals(StepLocation, KINDA_SMALL_NUMBER);
+}
+
+void FVFixedTimeStep::UpdateVisualComponent(USceneComponent& VisualComponent, const USceneComponent& UpdatedComponent, const FVector& BaseRelativeLocation, const FQuat& BaseRelativeRotation) const
+{
+    const FVector CurrentLocation(UpdatedComponent.GetComponentLocation());
+    const FQuat CurrentRotation(UpdatedComponent.GetComponentQuat());
+
+    // Interpolated updated component transform
+    const FVector InterpLocation(FMath::Lerp(PreviousLocation, CurrentLocation, InterpAlpha));
+    const FQuat InterpRotation(FQuat::FastLerp(PreviousRotation, CurrentRotation, InterpAlpha).GetNormalized());
+
+    // Visual world transform as if attached to the interpolated transform, converted back to current relative space
+    const FQuat InvCurrentRotation(CurrentRotation.Inverse());
+    const FVector VisualLocation(InterpLocation + InterpRotation.RotateVector(BaseRelativeLocation));
+
+    const FVector NewRelLocation(InvCurrentRotation.RotateVector(VisualLocation - CurrentLocation));
+    const FQuat NewRelRotation(InvCurrentRotation * InterpRotation * BaseRelativeRotation);
+
+    VisualComponent.SetRelativeLocationAndRotation(NewRelLocation, NewRelRotation);
+}
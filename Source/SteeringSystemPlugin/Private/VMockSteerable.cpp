@@ -0,0 +1,489 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+// 
+
+
+#include "VMockSteerable.h"
+#include "SteeringBehavior.h"
+#include "FormationBehavior.h"
+#include "Behaviors/ArriveBehavior.h"
+#include "Behaviors/MoveFormationBehavior.h"
+#include "HAL/IConsoleManager.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogVSteeringBenchmark, Log, All);
+
+namespace VSteeringBenchmarkCVars
+{
+    static FAutoConsoleCommand CmdRun(
+        TEXT("p.VSteeringBenchmark"),
+        TEXT("Run steering behavior and formation updates on mock steerables without a world. Arguments: [AgentCount=1000] [FormationSize=10] [FrameCount=300]"),
+        FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+        {
+            const int32 AgentCount    = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 1000;
+            const int32 FormationSize = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 10;
+            const int32 FrameCount    = Args.Num() > 2 ? FCString::Atoi(*Args[2]) : 300;
+
+            const double Elapsed = FVSteeringBenchmark::Run(AgentCount, FormationSize, FrameCount);
+            const int32 AgentFrames = FMath::Max(AgentCount, 1) * FMath::Max(FrameCount, 1);
+
+            UE_LOG(LogVSteeringBenchmark, Log,
+                TEXT("Steering benchmark: %d agents, formation size %d, %d frames: %.3f ms total, %.3f ms/frame, %.3f us/agent-update"),
+                AgentCount,
+                FormationSize,
+                FrameCount,
+                Elapsed * 1000.0,
+                Elapsed * 1000.0 / FMath::Max(FrameCount, 1),
+                Elapsed * 1000000.0 / AgentFrames);
+        }));
+}
+
+// ~ FVMockSteerable
+
+FVMockSteerable::FVMockSteerable()
+    : Location(ForceInitToZero)
+    , Orientation(FQuat::Identity)
+    , Velocity(ForceInitToZero)
+    , InnerRadius(50.f)
+    , OuterRadius(150.f)
+    , MaxLinearSpeed(600.f)
+    , MaxLinearAcceleration(0.f)
+    , MinControlInput(0.1f)
+    , Priority(0)
+    , Formation(nullptr)
+{
+}
+
+FVMockSteerable::~FVMockSteerable()
+{
+    SetFormation(nullptr);
+    ClearSteeringBehaviors();
+}
+
+void FVMockSteerable::Update(float DeltaTime)
+{
+    ControlInput = FSteeringAcceleration();
+
+    bool bCurrentBehaviorFinished;
+
+    // Execute current active behavior. If it finishes, immediately execute next behavior if any
+    do
+    {
+        bCurrentBehaviorFinished = false;
+
+        if (Behaviors.Num() > 0)
+        {
+            bCurrentBehaviorFinished = UpdateActiveBehavior(DeltaTime);
+        }
+    }
+    while (bCurrentBehaviorFinished);
+
+    // Integrate control input
+
+    Velocity = ControlInput.bEnableAcceleration
+        ? ControlInput.Linear.GetClampedToMaxSize(1.f) * MaxLinearSpeed
+        : FVector::ZeroVector;
+
+    Location += Velocity * DeltaTime;
+
+    if (! ControlInput.bLockOrientation && ! Velocity.IsNearlyZero())
+    {
+        Orientation = Velocity.ToOrientationQuat();
+    }
+}
+
+bool FVMockSteerable::UpdateActiveBehavior(float DeltaTime)
+{
+    check(Behaviors.Num() > 0);
+
+    FBehaviorListNode* Node(Behaviors.GetTail());
+    FPSSteeringBehavior& Behavior(Node->GetValue());
+    bool bInProgress = Behavior.IsValid();
+    bool bIsDone = false;
+
+    if (bInProgress)
+    {
+        if (! Behavior->IsActive())
+        {
+            Behavior->Activate();
+        }
+
+        FSteeringAcceleration BehaviorInput;
+
+        {
+            SCOPE_STEERING_BEHAVIOR_STAT(Behavior);
+            bIsDone = Behavior->CalculateSteering(DeltaTime, BehaviorInput);
+        }
+
+        ControlInput.Linear += BehaviorInput.Linear;
+        ControlInput.bEnableAcceleration = BehaviorInput.bEnableAcceleration;
+        ControlInput.bLockOrientation = BehaviorInput.bLockOrientation;
+
+        if (bIsDone)
+        {
+            if (Behavior->IsActive())
+            {
+                Behavior->Deactivate();
+            }
+
+            bInProgress = false;
+        }
+    }
+
+    // Behavior is finished, remove from stack and return true
+    if (! bInProgress)
+    {
+        if (Behavior.IsValid())
+        {
+            Behavior.Reset();
+            Behaviors.RemoveNode(Node, true);
+        }
+
+        bIsDone = true;
+    }
+
+    return bIsDone;
+}
+
+void FVMockSteerable::AddSteeringBehavior(FPSSteeringBehavior InBehavior)
+{
+    if (InBehavior.IsValid())
+    {
+        InBehavior->SetSteerable(this);
+        Behaviors.AddTail(InBehavior);
+    }
+}
+
+void FVMockSteerable::EnqueueSteeringBehavior(FPSSteeringBehavior InBehavior)
+{
+    if (InBehavior.IsValid())
+    {
+        InBehavior->SetSteerable(this);
+        Behaviors.AddHead(InBehavior);
+    }
+}
+
+void FVMockSteerable::RemoveSteeringBehavior(FPSSteeringBehavior InBehavior)
+{
+    if (InBehavior.IsValid())
+    {
+        FBehaviorListNode* Node(Behaviors.FindNode(InBehavior));
+
+        if (Node)
+        {
+            ResetRegisteredBehavior(Node->GetValue());
+            Behaviors.RemoveNode(Node, true);
+        }
+    }
+}
+
+void FVMockSteerable::ClearSteeringBehaviors()
+{
+    for (FPSSteeringBehavior& Behavior : Behaviors)
+    {
+        ResetRegisteredBehavior(Behavior);
+    }
+
+    Behaviors.Empty();
+}
+
+void FVMockSteerable::ResetRegisteredBehavior(FPSSteeringBehavior& Behavior)
+{
+    if (Behavior.IsValid())
+    {
+        if (Behavior->IsActive())
+        {
+            Behavior->Deactivate();
+        }
+
+        Behavior->SetSteerable(nullptr);
+        Behavior.Reset();
+    }
+}
+
+void FVMockSteerable::SetFormation(FSteeringFormation* InFormation, bool bSetAsPrimary)
+{
+    if (Formation == InFormation)
+    {
+        return;
+    }
+
+    if (Formation)
+    {
+        Formation->RemoveMember(this);
+    }
+
+    Formation = InFormation;
+
+    if (Formation)
+    {
+        Formation->AddMember(this, bSetAsPrimary);
+    }
+}
+
+void FVMockSteerable::SetFormationDirect(FSteeringFormation* InFormation)
+{
+    Formation = InFormation;
+}
+
+FSteeringFormation* FVMockSteerable::GetFormation()
+{
+    return Formation;
+}
+
+bool FVMockSteerable::HasFormation() const
+{
+    return Formation != nullptr;
+}
+
+FTickFunction* FVMockSteerable::GetSteerableTickFunction()
+{
+    return nullptr;
+}
+
+UObject* FVMockSteerable::GetSteerableObject()
+{
+    return nullptr;
+}
+
+FString FVMockSteerable::GetSteerableName() const
+{
+    return FString::Printf(TEXT("MockSteerable_%p"), this);
+}
+
+FVector FVMockSteerable::GetSteerableLocation() const
+{
+    return Location;
+}
+
+FQuat FVMockSteerable::GetSteerableOrientation() const
+{
+    return Orientation;
+}
+
+FVector FVMockSteerable::GetForwardVector() const
+{
+    return Orientation.GetForwardVector();
+}
+
+FVector FVMockSteerable::GetLinearVelocity() const
+{
+    return Velocity;
+}
+
+float FVMockSteerable::GetInnerRadius() const
+{
+    return InnerRadius;
+}
+
+float FVMockSteerable::GetOuterRadius() const
+{
+    return OuterRadius;
+}
+
+int32 FVMockSteerable::GetPriority() const
+{
+    return Priority;
+}
+
+float FVMockSteerable::GetMaxLinearSpeed() const
+{
+    return MaxLinearSpeed;
+}
+
+float FVMockSteerable::GetMaxLinearAcceleration() const
+{
+    return MaxLinearAcceleration;
+}
+
+float FVMockSteerable::GetMinControlInput() const
+{
+    return FMath::Max(MinControlInput, KINDA_SMALL_NUMBER);
+}
+
+// ~ FVMockFormationProxy
+
+FVMockFormationProxy::FVMockFormationProxy()
+    : AnchorLocation(ForceInitToZero)
+    , AnchorOrientation(FQuat::Identity)
+{
+    Formation.SetFormationProxy(this);
+}
+
+FVMockFormationProxy::~FVMockFormationProxy()
+{
+    Formation.ClearMembers();
+    Formation.ClearBehaviors();
+    Formation.SetFormationProxy(nullptr);
+}
+
+void FVMockFormationProxy::Update(float DeltaTime)
+{
+    Formation.UpdateFormation(DeltaTime);
+}
+
+void FVMockFormationProxy::AddFormationBehavior(FPSFormationBehavior InBehavior)
+{
+    if (InBehavior.IsValid())
+    {
+        Formation.AddBehavior(InBehavior);
+    }
+}
+
+void FVMockFormationProxy::EnqueueFormationBehavior(FPSFormationBehavior InBehavior)
+{
+    if (InBehavior.IsValid())
+    {
+        Formation.EnqueueBehavior(InBehavior);
+    }
+}
+
+void FVMockFormationProxy::RemoveFormationBehavior(FPSFormationBehavior InBehavior)
+{
+    if (InBehavior.IsValid())
+    {
+        Formation.RemoveBehavior(InBehavior);
+    }
+}
+
+void FVMockFormationProxy::ClearFormationBehaviors()
+{
+    Formation.ClearBehaviors();
+}
+
+void FVMockFormationProxy::AddMemberDependency(ISteerable* Member)
+{
+    // Mock steerables are updated explicitly after their formation, no tick dependency required
+}
+
+void FVMockFormationProxy::RemoveMemberDependency(ISteerable* Member)
+{
+}
+
+FVector FVMockFormationProxy::GetAnchorLocation() const
+{
+    return AnchorLocation;
+}
+
+FQuat FVMockFormationProxy::GetAnchorOrientation() const
+{
+    return AnchorOrientation;
+}
+
+void FVMockFormationProxy::SetAnchorLocationAndOrientation(const FVector& Location, const FQuat& Orientation)
+{
+    AnchorLocation = Location;
+    AnchorOrientation = Orientation;
+}
+
+void FVMockFormationProxy::SetAnchorLocation(const FVector& Location)
+{
+    AnchorLocation = Location;
+}
+
+void FVMockFormationProxy::SetAnchorOrientation(const FQuat& Orientation)
+{
+    AnchorOrientation = Orientation;
+}
+
+// ~ FVSteeringBenchmark
+
+double FVSteeringBenchmark::Run(int32 AgentCount, int32 FormationSize, int32 FrameCount, float DeltaTime)
+{
+    AgentCount = FMath::Max(AgentCount, 1);
+    FrameCount = FMath::Max(FrameCount, 1);
+
+    const float Spacing = 200.f;
+    const int32 GridSize = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(AgentCount)));
+    const FVector TargetLocation(GridSize * Spacing * 2.f, GridSize * Spacing * .5f, 0.f);
+
+    // Agents and formations are heap allocated so member pointers remain stable
+
+    TIndirectArray<FVMockSteerable> Agents;
+    TIndirectArray<FVMockFormationProxy> Formations;
+
+    Agents.Reserve(AgentCount);
+
+    for (int32 i=0; i<AgentCount; ++i)
+    {
+        FVMockSteerable* Agent = new FVMockSteerable();
+        Agent->Location = FVector((i % GridSize) * Spacing, (i / GridSize) * Spacing, 0.f);
+        Agents.Add(Agent);
+    }
+
+    if (FormationSize > 1)
+    {
+        Formations.Reserve(FMath::DivideAndRoundUp(AgentCount, FormationSize));
+
+        for (int32 i=0; i<AgentCount; i+=FormationSize)
+        {
+            FVMockFormationProxy* Proxy = new FVMockFormationProxy();
+            Proxy->SetAnchorLocation(Agents[i].Location);
+            Formations.Add(Proxy);
+
+            const int32 MemberEnd = FMath::Min(i+FormationSize, AgentCount);
+
+            for (int32 m=i; m<MemberEnd; ++m)
+            {
+                Agents[m].SetFormation(&Proxy->GetFormation(), m == i);
+            }
+
+            Proxy->AddFormationBehavior(FPSFormationBehavior( new FMoveFormationBehavior(FSteeringTarget(TargetLocation)) ));
+        }
+    }
+    else
+    {
+        for (FVMockSteerable& Agent : Agents)
+        {
+            Agent.AddSteeringBehavior(FPSSteeringBehavior( new FArriveBehavior(FSteeringTarget(TargetLocation), Agent.OuterRadius, Agent.InnerRadius) ));
+        }
+    }
+
+    // Simulate, formations are updated before their members as with formation tick prerequisites
+
+    const double StartTime = FPlatformTime::Seconds();
+
+    for (int32 Frame=0; Frame<FrameCount; ++Frame)
+    {
+        for (FVMockFormationProxy& Proxy : Formations)
+        {
+            Proxy.Update(DeltaTime);
+        }
+
+        for (FVMockSteerable& Agent : Agents)
+        {
+            Agent.Update(DeltaTime);
+        }
+    }
+
+    const double Elapsed = FPlatformTime::Seconds() - StartTime;
+
+    // Agents detach from their formations on destruction, release them first
+
+    Agents.Empty();
+    Formations.Empty();
+
+    return Elapsed;
+}
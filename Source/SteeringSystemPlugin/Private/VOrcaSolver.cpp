@@ -0,0 +1,564 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+// 
+
+#include "VOrcaSolver.h"
+#include "Engine/World.h"
+#include "Async/ParallelFor.h"
+
+DECLARE_CYCLE_STAT(TEXT("Orca Solve"), STAT_VOrcaSolver_Solve, STATGROUP_Steering);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Orca Agents"), STAT_VOrcaAgents, STATGROUP_Steering);
+
+namespace VOrcaCVars
+{
+    static int32 Parallel = 1;
+    FAutoConsoleVariableRef CVarParallel(
+        TEXT("p.VOrcaParallel"),
+        Parallel,
+        TEXT("Whether built-in ORCA avoidance agents are solved in parallel.\n")
+        TEXT("0: Disable, 1: Enable"),
+        ECVF_Default);
+
+    static float DivergenceThreshold = 1.f;
+    FAutoConsoleVariableRef CVarDivergenceThreshold(
+        TEXT("p.VOrcaDivergenceThreshold"),
+        DivergenceThreshold,
+        TEXT("Minimum distance between avoidance and preferred velocity for the avoidance velocity to override agent movement."),
+        ECVF_Default);
+}
+
+static const float ORCA_EPSILON = 0.00001f;
+
+TMap<const UWorld*, FPSOrcaSolver> FVOrcaSolver::Solvers;
+
+// ~ FVOrcaSolver
+
+FVOrcaSolver::FVOrcaSolver(const UWorld* InWorld)
+    : World(InWorld)
+    , InvCellSize(1.f)
+    , SolvedFrame(0)
+{
+}
+
+int32 FVOrcaSolver::AddAgent()
+{
+    FAgent Agent;
+    Agent.Location = FVector2D::ZeroVector;
+    Agent.Velocity = FVector2D::ZeroVector;
+    Agent.PreferredVelocity = FVector2D::ZeroVector;
+    Agent.AvoidanceVelocity = FVector2D::ZeroVector;
+    Agent.PreferredVelocityZ = 0.f;
+    Agent.MaxSpeed = 0.f;
+    Agent.bHasState = false;
+    Agent.bHasAvoidance = false;
+
+    return Agents.Add(Agent);
+}
+
+void FVOrcaSolver::RemoveAgent(int32 AgentId)
+{
+    if (Agents.IsValidIndex(AgentId))
+    {
+        Agents.RemoveAt(AgentId);
+    }
+}
+
+void FVOrcaSolver::SetAgentState(int32 AgentId, const FVector& Location, const FVector& Velocity, const FVector& PreferredVelocity, float MaxSpeed, const FVOrcaAgentSettings& Settings)
+{
+    check(Agents.IsValidIndex(AgentId));
+
+    FAgent& Agent(Agents[AgentId]);
+    Agent.Location = FVector2D(Location);
+    Agent.Velocity = FVector2D(Velocity);
+    Agent.PreferredVelocity = FVector2D(PreferredVelocity);
+    Agent.PreferredVelocityZ = PreferredVelocity.Z;
+    Agent.MaxSpeed = MaxSpeed;
+    Agent.Settings = Settings;
+    Agent.bHasState = true;
+}
+
+bool FVOrcaSolver::GetAvoidanceVelocity(int32 AgentId, FVector& OutVelocity)
+{
+    check(Agents.IsValidIndex(AgentId));
+
+    Solve();
+
+    const FAgent& Agent(Agents[AgentId]);
+
+    if (! Agent.bHasAvoidance)
+    {
+        return false;
+    }
+
+    OutVelocity = FVector(Agent.AvoidanceVelocity, Agent.PreferredVelocityZ);
+    return true;
+}
+
+void FVOrcaSolver::Solve()
+{
+    if (SolvedFrame == GFrameCounter)
+    {
+        return;
+    }
+
+    SolvedFrame = GFrameCounter;
+
+    const UWorld* SolverWorld = World.Get();
+
+    if (! SolverWorld)
+    {
+        return;
+    }
+
+    SCOPE_CYCLE_COUNTER(STAT_VOrcaSolver_Solve);
+
+    // Gather agents with valid state, cell size covers the largest neighbor distance
+
+    float CellSize = 1.f;
+
+    DenseAgents.Reset();
+
+    for (TSparseArray<FAgent>::TIterator It(Agents); It; ++It)
+    {
+        if (It->bHasState)
+        {
+            DenseAgents.Emplace(It.GetIndex());
+            CellSize = FMath::Max(CellSize, It->Settings.NeighborDistance);
+        }
+    }
+
+    INC_DWORD_STAT_BY(STAT_VOrcaAgents, DenseAgents.Num());
+
+    // Rebuild neighbor index
+
+    InvCellSize = 1.f / CellSize;
+
+    for (TPair<FIntPoint, TArray<int32>>& Cell : Grid)
+    {
+        Cell.Value.Reset();
+    }
+
+    for (int32 i=0; i<DenseAgents.Num(); ++i)
+    {
+        Grid.FindOrAdd(GetCell(Agents[DenseAgents[i]].Location)).Emplace(i);
+    }
+
+    // Solve agents
+
+    const float InvTimeStep = 1.f / FMath::Max(SolverWorld->GetDeltaSeconds(), KINDA_SMALL_NUMBER);
+
+    ParallelFor(
+        DenseAgents.Num(),
+        [this, InvTimeStep](int32 DenseIndex)
+        {
+            SolveAgent(DenseIndex, InvTimeStep);
+        },
+        VOrcaCVars::Parallel == 0
+        );
+
+    // Release empty cells
+    for (TMap<FIntPoint, TArray<int32>>::TIterator It(Grid); It; ++It)
+    {
+        if (It.Value().Num() == 0)
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
+
+void FVOrcaSolver::GatherNeighbors(int32 DenseIndex, TArray<int32, TInlineAllocator<32>>& OutNeighbors) const
+{
+    const FAgent& Agent(Agents[DenseAgents[DenseIndex]]);
+    const FIntPoint AgentCell(GetCell(Agent.Location));
+    const float RangeSq = FMath::Square(Agent.Settings.NeighborDistance);
+    const int32 MaxNeighbors = FMath::Max(1, Agent.Settings.MaxNeighbors);
+
+    TArray<float, TInlineAllocator<32>> DistancesSq;
+
+    // Cell size covers the largest neighbor distance, neighbors are within adjacent cells
+    for (int32 y=-1; y<=1; ++y)
+    for (int32 x=-1; x<=1; ++x)
+    {
+        const TArray<int32>* Cell = Grid.Find(AgentCell + FIntPoint(x, y));
+
+        if (! Cell)
+        {
+            continue;
+        }
+
+        for (int32 NeighborIndex : *Cell)
+        {
+            if (NeighborIndex == DenseIndex)
+            {
+                continue;
+            }
+
+            const float DistSq = FVector2D::DistSquared(Agent.Location, Agents[DenseAgents[NeighborIndex]].Location);
+
+            if (DistSq >= RangeSq)
+            {
+                continue;
+            }
+
+            // Keep closest neighbors sorted by distance
+            int32 InsertIndex = DistancesSq.Num();
+
+            while (InsertIndex > 0 && DistancesSq[InsertIndex-1] > DistSq)
+            {
+                --InsertIndex;
+            }
+
+            if (InsertIndex < MaxNeighbors)
+            {
+                DistancesSq.Insert(DistSq, InsertIndex);
+                OutNeighbors.Insert(NeighborIndex, InsertIndex);
+
+                if (OutNeighbors.Num() > MaxNeighbors)
+                {
+                    DistancesSq.Pop(false);
+                    OutNeighbors.Pop(false);
+                }
+            }
+        }
+    }
+}
+
+void FVOrcaSolver::SolveAgent(int32 DenseIndex, float InvTimeStep)
+{
+    FAgent& Agent(Agents[DenseAgents[DenseIndex]]);
+
+    TArray<int32, TInlineAllocator<32>> Neighbors;
+    GatherNeighbors(DenseIndex, Neighbors);
+
+    TArray<FLine, TInlineAllocator<32>> Lines;
+    Lines.Reserve(Neighbors.Num());
+
+    const float InvTimeHorizon = 1.f / FMath::Max(Agent.Settings.TimeHorizon, KINDA_SMALL_NUMBER);
+
+    // Construct ORCA half-planes of each neighbor
+    for (int32 NeighborIndex : Neighbors)
+    {
+        const FAgent& Other(Agents[DenseAgents[NeighborIndex]]);
+
+        const FVector2D RelativePosition(Other.Location - Agent.Location);
+        const FVector2D RelativeVelocity(Agent.Velocity - Other.Velocity);
+        const float DistSq = RelativePosition.SizeSquared();
+        const float CombinedRadius = Agent.Settings.Radius + Other.Settings.Radius;
+        const float CombinedRadiusSq = CombinedRadius * CombinedRadius;
+
+        FLine Line;
+        FVector2D U;
+
+        if (DistSq > CombinedRadiusSq)
+        {
+            // No collision, vector from cutoff center to relative velocity
+            const FVector2D W(RelativeVelocity - InvTimeHorizon*RelativePosition);
+            const float WLengthSq = W.SizeSquared();
+            const float DotProduct1 = W | RelativePosition;
+
+            if (DotProduct1 < 0.f && FMath::Square(DotProduct1) > CombinedRadiusSq*WLengthSq)
+            {
+                // Project on cutoff circle
+                const float WLength = FMath::Sqrt(WLengthSq);
+                const FVector2D UnitW(W / WLength);
+
+                Line.Direction = FVector2D(UnitW.Y, -UnitW.X);
+                U = (CombinedRadius*InvTimeHorizon - WLength) * UnitW;
+            }
+            else
+            {
+                // Project on legs
+                const float Leg = FMath::Sqrt(DistSq - CombinedRadiusSq);
+
+                if ((RelativePosition ^ W) > 0.f)
+                {
+                    // Project on left leg
+                    Line.Direction = FVector2D(
+                        RelativePosition.X*Leg - RelativePosition.Y*CombinedRadius,
+                        RelativePosition.X*CombinedRadius + RelativePosition.Y*Leg
+                        ) / DistSq;
+                }
+                else
+                {
+                    // Project on right leg
+                    Line.Direction = -FVector2D(
+                        RelativePosition.X*Leg + RelativePosition.Y*CombinedRadius,
+                        -RelativePosition.X*CombinedRadius + RelativePosition.Y*Leg
+                        ) / DistSq;
+                }
+
+                const float DotProduct2 = RelativeVelocity | Line.Direction;
+                U = DotProduct2*Line.Direction - RelativeVelocity;
+            }
+        }
+        else
+        {
+            // Collision, project on cutoff circle of time step
+            const FVector2D W(RelativeVelocity - InvTimeStep*RelativePosition);
+            const float WLength = W.Size();
+            const FVector2D UnitW(WLength > ORCA_EPSILON ? W/WLength : FVector2D(1.f, 0.f));
+
+            Line.Direction = FVector2D(UnitW.Y, -UnitW.X);
+            U = (CombinedRadius*InvTimeStep - WLength) * UnitW;
+        }
+
+        // Reciprocal, take half of the responsibility
+        Line.Point = Agent.Velocity + .5f*U;
+        Lines.Emplace(Line);
+    }
+
+    FVector2D NewVelocity;
+
+    const int32 LineFail = LinearProgram2(Lines, Agent.MaxSpeed, Agent.PreferredVelocity, false, NewVelocity);
+
+    if (LineFail < Lines.Num())
+    {
+        LinearProgram3(Lines, LineFail, Agent.MaxSpeed, NewVelocity);
+    }
+
+    Agent.AvoidanceVelocity = NewVelocity;
+    Agent.bHasAvoidance = FVector2D::DistSquared(NewVelocity, Agent.PreferredVelocity) > FMath::Square(VOrcaCVars::DivergenceThreshold);
+}
+
+bool FVOrcaSolver::LinearProgram1(const TArray<FLine, TInlineAllocator<32>>& Lines, int32 LineNo, float Radius, const FVector2D& OptVelocity, bool bDirectionOpt, FVector2D& Result)
+{
+    const FLine& Line(Lines[LineNo]);
+    const float DotProduct = Line.Point | Line.Direction;
+    const float Discriminant = FMath::Square(DotProduct) + FMath::Square(Radius) - Line.Point.SizeSquared();
+
+    // Max speed circle fully invalidates line
+    if (Discriminant < 0.f)
+    {
+        return false;
+    }
+
+    const float SqrtDiscriminant = FMath::Sqrt(Discriminant);
+    float TLeft = -DotProduct - SqrtDiscriminant;
+    float TRight = -DotProduct + SqrtDiscriminant;
+
+    for (int32 i=0; i<LineNo; ++i)
+    {
+        const float Denominator = Line.Direction ^ Lines[i].Direction;
+        const float Numerator = Lines[i].Direction ^ (Line.Point - Lines[i].Point);
+
+        // Lines are (almost) parallel
+        if (FMath::Abs(Denominator) <= ORCA_EPSILON)
+        {
+            if (Numerator < 0.f)
+            {
+                return false;
+            }
+
+            continue;
+        }
+
+        const float T = Numerator / Denominator;
+
+        if (Denominator >= 0.f)
+        {
+            // Line i bounds line on the right
+            TRight = FMath::Min(TRight, T);
+        }
+        else
+        {
+            // Line i bounds line on the left
+            TLeft = FMath::Max(TLeft, T);
+        }
+
+        if (TLeft > TRight)
+        {
+            return false;
+        }
+    }
+
+    if (bDirectionOpt)
+    {
+        // Optimize direction
+        Result = Line.Point + ((OptVelocity | Line.Direction) > 0.f ? TRight : TLeft) * Line.Direction;
+    }
+    else
+    {
+        // Optimize closest point
+        const float T = Line.Direction | (OptVelocity - Line.Point);
+        Result = Line.Point + FMath::Clamp(T, TLeft, TRight) * Line.Direction;
+    }
+
+    return true;
+}
+
+int32 FVOrcaSolver::LinearProgram2(const TArray<FLine, TInlineAllocator<32>>& Lines, float Radius, const FVector2D& OptVelocity, bool bDirectionOpt, FVector2D& Result)
+{
+    if (bDirectionOpt)
+    {
+        // Optimize direction, velocity is unit length
+        Result = OptVelocity * Radius;
+    }
+    else if (OptVelocity.SizeSquared() > FMath::Square(Radius))
+    {
+        // Optimize closest point, outside circle
+        Result = OptVelocity.GetSafeNormal() * Radius;
+    }
+    else
+    {
+        // Optimize closest point, inside circle
+        Result = OptVelocity;
+    }
+
+    for (int32 i=0; i<Lines.Num(); ++i)
+    {
+        // Result does not satisfy constraint i, compute new optimal result
+        if ((Lines[i].Direction ^ (Lines[i].Point - Result)) > 0.f)
+        {
+            const FVector2D TempResult(Result);
+
+            if (! LinearProgram1(Lines, i, Radius, OptVelocity, bDirectionOpt, Result))
+            {
+                Result = TempResult;
+                return i;
+            }
+        }
+    }
+
+    return Lines.Num();
+}
+
+void FVOrcaSolver::LinearProgram3(const TArray<FLine, TInlineAllocator<32>>& Lines, int32 BeginLine, float Radius, FVector2D& Result)
+{
+    float Distance = 0.f;
+
+    for (int32 i=BeginLine; i<Lines.Num(); ++i)
+    {
+        // Result does not satisfy constraint of line i
+        if ((Lines[i].Direction ^ (Lines[i].Point - Result)) <= Distance)
+        {
+            continue;
+        }
+
+        TArray<FLine, TInlineAllocator<32>> ProjectedLines;
+
+        for (int32 j=0; j<i; ++j)
+        {
+            FLine Line;
+            const float Determinant = Lines[i].Direction ^ Lines[j].Direction;
+
+            if (FMath::Abs(Determinant) <= ORCA_EPSILON)
+            {
+                // Line i and line j point in the same direction
+                if ((Lines[i].Direction | Lines[j].Direction) > 0.f)
+                {
+                    continue;
+                }
+
+                // Line i and line j point in opposite direction
+                Line.Point = .5f * (Lines[i].Point + Lines[j].Point);
+            }
+            else
+            {
+                Line.Point = Lines[i].Point + ((Lines[j].Direction ^ (Lines[i].Point - Lines[j].Point)) / Determinant) * Lines[i].Direction;
+            }
+
+            Line.Direction = (Lines[j].Direction - Lines[i].Direction).GetSafeNormal();
+            ProjectedLines.Emplace(Line);
+        }
+
+        const FVector2D TempResult(Result);
+
+        // This should in principle not happen, the result is by definition already in the feasible region of this linear program.
+        // If it fails, it is due to small floating point error, and the current result is kept.
+        if (LinearProgram2(ProjectedLines, Radius, FVector2D(-Lines[i].Direction.Y, Lines[i].Direction.X), true, Result) < ProjectedLines.Num())
+        {
+            Result = TempResult;
+        }
+
+        Distance = Lines[i].Direction ^ (Lines[i].Point - Result);
+    }
+}
+
+FPSOrcaSolver FVOrcaSolver::Register(const UWorld* InWorld)
+{
+    check(IsInGameThread());
+
+    FPSOrcaSolver& Solver(Solvers.FindOrAdd(InWorld));
+
+    if (! Solver.IsValid())
+    {
+        Solver = MakeShareable(new FVOrcaSolver(InWorld));
+    }
+
+    return Solver;
+}
+
+void FVOrcaSolver::Unregister(const UWorld* InWorld)
+{
+    check(IsInGameThread());
+
+    FPSOrcaSolver* Solver = Solvers.Find(InWorld);
+
+    if (Solver && (! Solver->IsValid() || (*Solver)->Num() == 0))
+    {
+        Solvers.Remove(InWorld);
+    }
+}
+
+// ~ FVOrcaAgentHandle
+
+void FVOrcaAgentHandle::Register(const UWorld* InWorld)
+{
+    Unregister();
+
+    if (InWorld)
+    {
+        World = InWorld;
+        Solver = FVOrcaSolver::Register(InWorld);
+        AgentId = Solver->AddAgent();
+    }
+}
+
+void FVOrcaAgentHandle::Unregister()
+{
+    if (Solver.IsValid())
+    {
+        Solver->RemoveAgent(AgentId);
+        Solver.Reset();
+        FVOrcaSolver::Unregister(World);
+    }
+
+    World = nullptr;
+    AgentId = INDEX_NONE;
+}
+
+void FVOrcaAgentHandle::SetState(const FVector& Location, const FVector& Velocity, const FVector& PreferredVelocity, float MaxSpeed, const FVOrcaAgentSettings& Settings) const
+{
+    if (IsRegistered())
+    {
+        Solver->SetAgentState(AgentId, Location, Velocity, PreferredVelocity, MaxSpeed, Settings);
+    }
+}
+
+bool FVOrcaAgentHandle::GetAvoidanceVelocity(FVector& OutVelocity) const
+{
+    return IsRegistered() && Solver->GetAvoidanceVelocity(AgentId, OutVelocity);
+}
@@ -69,6 +69,13 @@ DECLARE_CYCLE_STAT(TEXT("VPC Physics Interaction"), STAT_VPCPhysicsInteraction,
 DECLARE_CYCLE_STAT(TEXT("VPC Update Acceleration"), STAT_VPCUpdateAcceleration, STATGROUP_Steering);
 DECLARE_CYCLE_STAT(TEXT("VPC MoveUpdateDelegate"), STAT_VPCMoveUpdateDelegate, STATGROUP_Steering);
 
+// Global per-frame full rate network smoothing budget state
+namespace VPCMovementSmoothingBudget
+{
+    static uint64 Frame = 0;
+    static int32 Count = 0;
+}
+
 const float UVPCMovementComponent::MIN_TICK_TIME = 1e-6f;
 const float UVPCMovementComponent::BRAKE_TO_STOP_VELOCITY = 10.f;
 
@@ -120,6 +127,22 @@ namespace VPCMovementCVars
         TEXT( "If 1, remove invalid replay samples that can occur due to oversampling (sampling at higher rate than physics is being ticked)" ),
         ECVF_Default);
 
+    static int32 NetEnableSmoothingLOD = 1;
+    FAutoConsoleVariableRef CVarNetEnableSmoothingLOD(
+        TEXT("p.VPCNetEnableSmoothingLOD"),
+        NetEnableSmoothingLOD,
+        TEXT("Whether to enable network smoothing level of detail on simulated proxies that have bEnableNetworkSmoothingLOD set.\n")
+        TEXT("0: Disable, 1: Enable"),
+        ECVF_Default);
+
+    static int32 NetSmoothingBudget = 0;
+    FAutoConsoleVariableRef CVarNetSmoothingBudget(
+        TEXT("p.VPCNetSmoothingBudget"),
+        NetSmoothingBudget,
+        TEXT("Maximum number of simulated proxies smoothed at full rate per frame, remaining proxies are smoothed at reduced rate.\n")
+        TEXT("<=0: Unlimited, >0: Full rate smoothing budget per frame"),
+        ECVF_Default);
+
 #if !UE_BUILD_SHIPPING
 
     static int32 NetShowCorrections = 0;
@@ -206,6 +229,10 @@ UVPCMovementComponent::UVPCMovementComponent(const FObjectInitializer& ObjectIni
 
     bEnableScopedMovementUpdates = true;
 
+    bUseFixedTimeStep = false;
+    FixedTimeStep = 1.f / 30.f;
+    MaxFixedTimeSteps = 4;
+
     OldBaseQuat = FQuat::Identity;
     OldBaseLocation = FVector::ZeroVector;
 
@@ -225,11 +252,9 @@ UVPCMovementComponent::UVPCMovementComponent(const FObjectInitializer& ObjectIni
 
     // Orientation
     bLockedOrientation = false;
-    bUseTurnRange = false;
     TurnRate = 45.f;
     MinTurnRate = -1.f;
     TurnAcceleration = 45.f;
-    CurrentTurnRate = 0.f;
 
     RotationRate = FRotator(0.f, 360.0f, 0.0f);
 
@@ -249,6 +274,11 @@ UVPCMovementComponent::UVPCMovementComponent(const FObjectInitializer& ObjectIni
     NetworkNoSmoothUpdateDistance = 384.f;
     NetworkSmoothingMode = ENetworkSmoothingMode::Exponential;
     bCancelAdaptiveReplicationEnabled = true;
+    bEnableNetworkSmoothingLOD = false;
+    NetworkSmoothingLODReducedDistance = 4000.f;
+    NetworkSmoothingLODSnapDistance = 15000.f;
+    NetworkSmoothingLODReducedInterval = 0.1f;
+    NetworkReplaySampleCapacity = 64;
 
     ClientPredictionData = NULL;
     ServerPredictionData = NULL;
@@ -258,6 +288,7 @@ UVPCMovementComponent::UVPCMovementComponent(const FObjectInitializer& ObjectIni
     bJustTeleported = true;
     LastUpdateRotation = FQuat::Identity;
     LastUpdateVelocity = FVector::ZeroVector;
+    SimulatedInputVector = FVector::ZeroVector;
     PendingImpulseToApply = FVector::ZeroVector;
 
     bEnablePhysicsInteraction = true;
@@ -276,6 +307,7 @@ UVPCMovementComponent::UVPCMovementComponent(const FObjectInitializer& ObjectIni
     // Avoidance
     bAutoRegisterRVOAgentComponent = true;
     bUseRVOAvoidance = false;
+    bUseBuiltInAvoidance = false;
     bUseRVOPostProcess = false;
     bZeroVelocityRVO = false;
     ZeroVelocityRVOThreshold = 20.f;
@@ -327,8 +359,8 @@ void UVPCMovementComponent::OnRegister()
         }
     }
 
-    // Auto register rvo agent component if enabled
-    if (! RVOAgentComponent && bUseRVOAvoidance && bAutoRegisterRVOAgentComponent)
+    // Auto register rvo agent component if enabled, built-in avoidance does not use it
+    if (! RVOAgentComponent && bUseRVOAvoidance && bAutoRegisterRVOAgentComponent && ! bUseBuiltInAvoidance)
     {
         // Auto-register owner's rvo agent component if found.
         if (AActor* MyActor = GetOwner())
@@ -345,6 +377,13 @@ void UVPCMovementComponent::OnRegister()
     RefreshTurnRange();
 }
 
+void UVPCMovementComponent::OnUnregister()
+{
+    AvoidanceAgent.Unregister();
+
+    Super::OnUnregister();
+}
+
 void UVPCMovementComponent::BeginDestroy()
 {
     if (ClientPredictionData)
@@ -362,6 +401,23 @@ void UVPCMovementComponent::BeginDestroy()
     Super::BeginDestroy();
 }
 
+void UVPCMovementComponent::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
+{
+    Super::GetResourceSizeEx(CumulativeResourceSize);
+
+    // Network prediction data and replay sample storage
+    if (ClientPredictionData)
+    {
+        CumulativeResourceSize.AddDedicatedSystemMemoryBytes(sizeof(FNetworkPredictionData_Client_VPC));
+        CumulativeResourceSize.AddDedicatedSystemMemoryBytes(ClientPredictionData->ReplaySamples.GetAllocatedSize());
+    }
+
+    if (ServerPredictionData)
+    {
+        CumulativeResourceSize.AddDedicatedSystemMemoryBytes(sizeof(FNetworkPredictionData_Server_VPC));
+    }
+}
+
 void UVPCMovementComponent::Deactivate()
 {
     Super::Deactivate();
@@ -414,6 +470,11 @@ void UVPCMovementComponent::SetUpdatedComponent(USceneComponent* NewUpdatedCompo
 
     CharacterOwner = Cast<AVPawnChar>(PawnOwner);
 
+    if (UpdatedComponent)
+    {
+        FixedTimeStepState.ResetStepState(*UpdatedComponent);
+    }
+
     if (UpdatedComponent != OldUpdatedComponent)
     {
         ClearAccumulatedForces();
@@ -660,11 +721,19 @@ void UVPCMovementComponent::TickComponent(float DeltaTime, enum ELevelTick TickT
             AnalogInputModifier = bIsMoveInputEnabled ? ComputeAnalogInputModifier() : 0.f;
         }
 
-        PerformMovement(DeltaTime);
+        if (bUseFixedTimeStep)
+        {
+            PerformFixedTimeStepMovement(DeltaTime);
+        }
+        else
+        {
+            PerformMovement(DeltaTime);
+        }
     }
     // Client (replicated predictive) movement
     else if (CharacterOwner->Role == ROLE_SimulatedProxy)
     {
+        SimulatedInputVector = bIsMoveInputEnabled ? InputVector : FVector::ZeroVector;
         SimulatedTick(DeltaTime);
     }
 
@@ -823,6 +892,13 @@ void UVPCMovementComponent::SimulateMovement(float DeltaTime)
         Acceleration = Velocity.GetSafeNormal();    // Not currently used for simulated movement
         AnalogInputModifier = 1.0f;                 // Not currently used for simulated movement
 
+        // Locally supplied control input steers replicated velocity until the next server correction
+        if (bIsSimulatedProxy && ! SimulatedInputVector.IsZero())
+        {
+            const FVector TargetVelocity = SimulatedInputVector.GetClampedToMaxSize(1.f) * GetMaxSpeed();
+            Velocity = FMath::VInterpConstantTo(Velocity, TargetVelocity, DeltaTime, GetMaxAcceleration());
+        }
+
         MaybeUpdateBasedMovement(DeltaTime);
 
         // Simulated pawns predict location
@@ -1151,6 +1227,43 @@ void UVPCMovementComponent::PerformMovement(float DeltaTime)
     LastUpdateVelocity = Velocity;
 }
 
+void UVPCMovementComponent::PerformFixedTimeStepMovement(float DeltaTime)
+{
+    // Snap visuals on the first update and after moves outside of fixed steps.
+    // Teleports reset step state in OnTeleported(), bJustTeleported is only cleared within a step and is not checked here.
+    if (HasValidData() && FixedTimeStepState.RequiresReset(*UpdatedComponent))
+    {
+        FixedTimeStepState.ResetStepState(*UpdatedComponent);
+    }
+
+    const float StepTime = FMath::Max(FixedTimeStep, 0.001f);
+    const int32 StepCount = FixedTimeStepState.Advance(DeltaTime, StepTime, MaxFixedTimeSteps);
+
+    for (int32 i=0; i<StepCount; ++i)
+    {
+        if (! HasValidData())
+        {
+            return;
+        }
+
+        FixedTimeStepState.SaveStepState(*UpdatedComponent);
+        PerformMovement(StepTime);
+    }
+
+    if (HasValidData())
+    {
+        FixedTimeStepState.FinishSteps(*UpdatedComponent);
+    }
+
+    // Interpolate mesh root between the last two steps, not required without visuals
+    USceneComponent* Mesh = HasValidData() ? CharacterOwner->GetMeshRoot() : nullptr;
+
+    if (Mesh && ! IsNetMode(NM_DedicatedServer))
+    {
+        FixedTimeStepState.UpdateVisualComponent(*Mesh, *UpdatedComponent, CharacterOwner->GetBaseTranslationOffset(), CharacterOwner->GetBaseRotationOffset());
+    }
+}
+
 bool UVPCMovementComponent::ShouldCancelAdaptiveReplication() const
 {
     // Update sooner if important properties changed.
@@ -1410,14 +1523,34 @@ void UVPCMovementComponent::SetRVOAgentComponent(URVO3DAgentComponent* InRVOAgen
 {
     // Don't assign pending kill components, but allow those to null out previous value
     RVOAgentComponent = IsValid(InRVOAgentComponent) ? InRVOAgentComponent : nullptr;
+    AvoidanceSchedule.Reset();
 }
 
 void UVPCMovementComponent::CalcAvoidanceVelocity()
 {
     check(HasValidData());
 
-    // Make sure avoidance is enabled with rvo agent component available and run on authoritative role
-    if (! bUseRVOAvoidance || ! RVOAgentComponent || CharacterOwner->Role != ROLE_Authority)
+    // Make sure avoidance is enabled and run on authoritative role
+    if (! bUseRVOAvoidance || CharacterOwner->Role != ROLE_Authority)
+    {
+        return;
+    }
+
+    // Push agent state to the built-in solver, avoidance is solved in batch on the first query of the frame
+    if (bUseBuiltInAvoidance)
+    {
+        if (! AvoidanceAgent.IsRegistered())
+        {
+            AvoidanceAgent.Register(GetWorld());
+        }
+
+        const float CompMaxSpeed = GetMaxSpeed();
+        AvoidanceAgent.SetState(UpdatedComponent->GetComponentLocation(), Velocity, GetLastInputVector() * CompMaxSpeed, CompMaxSpeed, BuiltInAvoidanceSettings);
+        return;
+    }
+
+    // Make sure rvo agent component is available
+    if (! RVOAgentComponent)
     {
         return;
     }
@@ -1436,6 +1569,16 @@ void UVPCMovementComponent::CalcAvoidanceVelocity()
         // Calculate RVO if not already performing locked avoidance
         if (! RVOAgentComponent->HasLockedPreferredVelocity())
         {
+            const UWorld* World = GetWorld();
+            const float WorldTime = World ? World->GetTimeSeconds() : 0.f;
+
+            // Reuse last avoidance state until the next scheduled solve.
+            // The agent component keeps ticking at its own rate, neighbors always see its current state.
+            if (! AvoidanceSchedule.ShouldUpdate(WorldTime))
+            {
+                return;
+            }
+
             if (RVOAgentComponent->HasAvoidanceVelocity())
             {
                 // Whether current RVO performed with minimal velocity
@@ -1451,6 +1594,8 @@ void UVPCMovementComponent::CalcAvoidanceVelocity()
                     RVOAgentComponent->LockPreferredVelocity(InputControl * GetMaxSpeed());
                 }
             }
+
+            AvoidanceSchedule.Schedule(WorldTime, InputControl * GetMaxSpeed(), RVOAgentComponent->GetAvoidanceVelocity(), GetMaxSpeed());
         }
     }
 }
@@ -1460,6 +1605,22 @@ void UVPCMovementComponent::PostProcessAvoidanceVelocity(FVector& NewVelocity)
     // Blank implementation
 }
 
+bool UVPCMovementComponent::GetAvoidanceVelocity(FVector& OutVelocity) const
+{
+    if (bUseBuiltInAvoidance)
+    {
+        return AvoidanceAgent.GetAvoidanceVelocity(OutVelocity);
+    }
+
+    if (RVOAgentComponent && RVOAgentComponent->HasLockedPreferredVelocity())
+    {
+        OutVelocity = RVOAgentComponent->GetAvoidanceVelocity();
+        return true;
+    }
+
+    return false;
+}
+
 void UVPCMovementComponent::NotifyBumpedPawn(APawn* BumpedPawn)
 {
     Super::NotifyBumpedPawn(BumpedPawn);
@@ -1652,6 +1813,8 @@ void UVPCMovementComponent::OnTeleported()
 
     bJustTeleported = true;
     MaybeSaveBaseLocation();
+
+    FixedTimeStepState.ResetStepState(*UpdatedComponent);
 }
 
 FRotator UVPCMovementComponent::GetDeltaRotation(float DeltaTime) const
@@ -2018,10 +2181,11 @@ void UVPCMovementComponent::ForceReplicationUpdate()
 
 FVector UVPCMovementComponent::ConstrainInputAcceleration(const FVector& InputAcceleration) const
 {
+    FVector AvoidanceVelocity;
+
     // Override input with RVO if required
-    if (bUseRVOAvoidance && RVOAgentComponent && RVOAgentComponent->HasLockedPreferredVelocity())
+    if (bUseRVOAvoidance && GetAvoidanceVelocity(AvoidanceVelocity))
     {
-        const FVector AvoidanceVelocity( RVOAgentComponent->GetAvoidanceVelocity() );
         const FVector AvoidanceDirection( AvoidanceVelocity.GetSafeNormal() );
         const float CompMaxSpeed = GetMaxSpeed();
         const float AvoidanceMagnitude = CompMaxSpeed>0.f ? (AvoidanceVelocity.Size() / CompMaxSpeed) : 0.f;
@@ -2058,7 +2222,7 @@ float UVPCMovementComponent::GetAnalogInputModifier() const
 
 float UVPCMovementComponent::GetCurrentTurnRate() const
 {
-    return CurrentTurnRate;
+    return MovementKernel.GetCurrentTurnRate();
 }
 
 float UVPCMovementComponent::GetTurnRate() const
@@ -2096,17 +2260,7 @@ void UVPCMovementComponent::SetTurnAcceleration(float InTurnAcceleration)
 
 void UVPCMovementComponent::RefreshTurnRange()
 {
-    bUseTurnRange = (MinTurnRate > 0.f) && (MinTurnRate < TurnRate) && (TurnAcceleration > 0.f);
-
-    if (bUseTurnRange)
-    {
-        TurnInterpRangeInv = 1.f / (TurnRate-MinTurnRate);
-        ClearTurnRange();
-    }
-    else
-    {
-        CurrentTurnRate = TurnRate;
-    }
+    MovementKernel.RefreshTurnRange(TurnRate, MinTurnRate, TurnAcceleration);
 }
 
 void UVPCMovementComponent::K2_RefreshTurnRange()
@@ -2114,79 +2268,6 @@ void UVPCMovementComponent::K2_RefreshTurnRange()
     RefreshTurnRange();
 }
 
-void UVPCMovementComponent::PrepareTurnRange(float DeltaTime, const FVector& VelocityNormal, const FVector& InputNormal)
-{
-    // turn range is not enabled, directly set current turn rate and return
-    if (! bUseTurnRange)
-    {
-        if (CurrentTurnRate < TurnRate)
-        {
-            CurrentTurnRate = TurnRate;
-        }
-        return;
-    }
-
-    if (LastTurnDelta.SizeSquared() > 0.f)
-    {
-        FVector TurnDelta = InputNormal - VelocityNormal;
-
-        // Turning towards the same direction since last update, accelerate turn rate
-        if ((LastTurnDelta|TurnDelta) > 0.f)
-        {
-            // Update turn rate if not yet reached maximum turn rate
-            if (CurrentTurnRate < TurnRate)
-            {
-                const float TurnInterpAlpha = ((CurrentTurnRate-MinTurnRate) + TurnAcceleration*DeltaTime) * TurnInterpRangeInv;
-                const float TurnInterpSpeed = FMath::Lerp(MinTurnRate, TurnRate, FMath::Clamp(TurnInterpAlpha, 0.f, 1.f));
-                CurrentTurnRate = FMath::Min(TurnInterpSpeed, TurnRate);
-            }
-        }
-        // Turning towards the opposite direction from last update, reset turn rate
-        else
-        {
-            ClearTurnRange();
-        }
-
-        LastTurnDelta = TurnDelta;
-    }
-    else
-    {
-        ClearTurnRange();
-        LastTurnDelta = (InputNormal-VelocityNormal).GetSafeNormal();
-    }
-}
-
-void UVPCMovementComponent::ClearTurnRange()
-{
-    if (bUseTurnRange && CurrentTurnRate > MinTurnRate)
-    {
-        CurrentTurnRate = MinTurnRate;
-        LastTurnDelta = FVector::ZeroVector;
-    }
-}
-
-void UVPCMovementComponent::InterpOrientation(FQuat& Orientation, const FVector& Current, const FVector& Target, float DeltaTime, float RotationSpeedDegrees)
-{
-    // Find delta rotation between both normals.
-    FQuat DeltaQuat = FQuat::FindBetweenNormals(Current, Target);
-
-    // Decompose into an axis and angle for rotation
-    FVector DeltaAxis(0.f);
-    float DeltaAngle = 0.f;
-    DeltaQuat.ToAxisAndAngle(DeltaAxis, DeltaAngle);
-
-    // Find rotation step for this frame
-    const float RotationStepRadians = RotationSpeedDegrees * (PI / 180) * DeltaTime;
-
-    if (FMath::Abs(DeltaAngle) > RotationStepRadians)
-    {
-        DeltaAngle = FMath::Clamp(DeltaAngle, -RotationStepRadians, RotationStepRadians);
-        DeltaQuat = FQuat(DeltaAxis, DeltaAngle);
-    }
-
-    Orientation = DeltaQuat * Orientation;
-}
-
 void UVPCMovementComponent::PhysicsOrientation(float DeltaTime)
 {
     // Not enough acceleration magnitude, abort
@@ -2198,23 +2279,7 @@ void UVPCMovementComponent::PhysicsOrientation(float DeltaTime)
     VelocityOrientation = UpdatedComponent->GetComponentQuat();
 
     // Orient velocity towards acceleration
-    {
-        const FVector VelocityNormal = VelocityOrientation.GetForwardVector();
-        const FVector AccelerationNormal = Acceleration.GetUnsafeNormal();
-
-        // Interpolate velocity direction
-        if (! FVector::Coincident(VelocityNormal, AccelerationNormal))
-        {
-            PrepareTurnRange(DeltaTime, VelocityNormal, AccelerationNormal);
-            InterpOrientation(VelocityOrientation, VelocityNormal, AccelerationNormal, DeltaTime, CurrentTurnRate);
-        }
-        // Set direction directly if above dot threshold
-        else
-        {
-            ClearTurnRange();
-            InterpOrientation(VelocityOrientation, VelocityNormal, AccelerationNormal, DeltaTime, CurrentTurnRate);
-        }
-    }
+    MovementKernel.Orient(VelocityOrientation, Acceleration.GetUnsafeNormal(), DeltaTime);
 }
 
 // ~ REPLICATION
@@ -2411,6 +2476,123 @@ FArchive& operator<<( FArchive& Ar, FVPCReplaySample& V )
     return Ar;
 }
 
+void FVPCReplaySampleBuffer::SetCapacity(int32 InCapacity)
+{
+    Samples.SetNumUninitialized(FMath::Max(InCapacity, 2), true);
+    Reset();
+}
+
+void FVPCReplaySampleBuffer::Add(const FVPCReplaySample& Sample)
+{
+    check(Samples.Num() > 0);
+
+    // Samples are kept ordered by time, restart on replay scrub
+    if (Count > 0 && Sample.Time < Last().Time)
+    {
+        Reset();
+    }
+
+    // Discard oldest sample if full
+    if (Count == Samples.Num())
+    {
+        RemoveFirst();
+    }
+
+    Samples[GetStorageIndex(Count)] = Sample;
+    ++Count;
+}
+
+void FVPCReplaySampleBuffer::RemoveFirst(int32 RemoveCount)
+{
+    RemoveCount = FMath::Min(RemoveCount, Count);
+
+    Head = GetStorageIndex(RemoveCount);
+    Count -= RemoveCount;
+    Cursor = FMath::Max(Cursor-RemoveCount, 0);
+
+    if (Count == 0)
+    {
+        Head = 0;
+    }
+}
+
+int32 FVPCReplaySampleBuffer::FindBracket(float Time)
+{
+    if (Count < 2 || Time < (*this)[0].Time || Time > Last().Time)
+    {
+        return INDEX_NONE;
+    }
+
+    // Playback advances monotonically, check cached and next bracket first
+    for (int32 i=Cursor; i<FMath::Min(Cursor+2, Count-1); ++i)
+    {
+        if (Time >= (*this)[i].Time && Time <= (*this)[i+1].Time)
+        {
+            Cursor = i;
+            return i;
+        }
+    }
+
+    // Binary search last sample with time <= Time
+    int32 Lo = 0;
+    int32 Hi = Count-2;
+
+    while (Lo < Hi)
+    {
+        const int32 Mid = (Lo + Hi + 1) / 2;
+
+        if ((*this)[Mid].Time <= Time)
+        {
+            Lo = Mid;
+        }
+        else
+        {
+            Hi = Mid-1;
+        }
+    }
+
+    Cursor = Lo;
+    return Lo;
+}
+
+int32 FVPCReplaySampleBuffer::FindNearest(float Time) const
+{
+    if (Count == 0)
+    {
+        return INDEX_NONE;
+    }
+
+    if (Time <= (*this)[0].Time)
+    {
+        return 0;
+    }
+
+    if (Time >= Last().Time)
+    {
+        return Count-1;
+    }
+
+    // Binary search first sample with time >= Time
+    int32 Lo = 0;
+    int32 Hi = Count-1;
+
+    while (Lo < Hi)
+    {
+        const int32 Mid = (Lo + Hi) / 2;
+
+        if ((*this)[Mid].Time < Time)
+        {
+            Lo = Mid+1;
+        }
+        else
+        {
+            Hi = Mid;
+        }
+    }
+
+    return (((*this)[Lo].Time - Time) < (Time - (*this)[Lo-1].Time)) ? Lo : (Lo-1);
+}
+
 void UVPCMovementComponent::SmoothClientPosition(float DeltaTime)
 {
     if (!HasValidData() || NetworkSmoothingMode == ENetworkSmoothingMode::Disabled)
@@ -2431,11 +2613,117 @@ void UVPCMovementComponent::SmoothClientPosition(float DeltaTime)
         return;
     }
 
+    // Scale smoothing cost by proxy relevance, replays always interpolate between samples
+    if (bEnableNetworkSmoothingLOD && VPCMovementCVars::NetEnableSmoothingLOD > 0 && NetworkSmoothingMode != ENetworkSmoothingMode::Replay)
+    {
+        FNetworkPredictionData_Client_VPC* ClientData = GetPredictionData_Client_VPC();
+
+        if (ClientData)
+        {
+            const EVPCSmoothingLOD SmoothingLOD = CalcNetworkSmoothingLOD();
+
+            if (SmoothingLOD == EVPCSmoothingLOD::Snap)
+            {
+                SmoothClientPosition_Snap();
+                return;
+            }
+
+            // Accumulate smoothing time and only update once reduced interval has elapsed
+            ClientData->SmoothingLODAccumulatedTime += DeltaTime;
+
+            if (SmoothingLOD == EVPCSmoothingLOD::Reduced && ClientData->SmoothingLODAccumulatedTime < NetworkSmoothingLODReducedInterval)
+            {
+                return;
+            }
+
+            DeltaTime = ClientData->SmoothingLODAccumulatedTime;
+            ClientData->SmoothingLODAccumulatedTime = 0.f;
+        }
+    }
+
     // Update mesh offsets
     SmoothClientPosition_Interpolate(DeltaTime);
     SmoothClientPosition_UpdateVisuals();
 }
 
+void UVPCMovementComponent::SmoothClientPosition_Snap()
+{
+    FNetworkPredictionData_Client_VPC* ClientData = GetPredictionData_Client_VPC();
+
+    if (ClientData)
+    {
+        ClientData->MeshTranslationOffset = FVector::ZeroVector;
+        ClientData->MeshRotationOffset = ClientData->MeshRotationTarget;
+        ClientData->SmoothingClientTimeStamp = ClientData->SmoothingServerTimeStamp;
+        ClientData->SmoothingLODAccumulatedTime = 0.f;
+
+        bNetworkSmoothingComplete = true;
+
+        SmoothClientPosition_UpdateVisuals();
+    }
+}
+
+EVPCSmoothingLOD UVPCMovementComponent::CalcNetworkSmoothingLOD() const
+{
+    const UWorld* MyWorld = GetWorld();
+
+    if (! MyWorld || ! UpdatedComponent)
+    {
+        return EVPCSmoothingLOD::Full;
+    }
+
+    // Find squared distance to the closest local view
+
+    const FVector ProxyLocation = UpdatedComponent->GetComponentLocation();
+    float MinViewDistSq = BIG_NUMBER;
+
+    for (FConstPlayerControllerIterator It = MyWorld->GetPlayerControllerIterator(); It; ++It)
+    {
+        const APlayerController* PC = It->Get();
+
+        if (PC && PC->IsLocalController())
+        {
+            FVector ViewLocation;
+            FRotator ViewRotation;
+            PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+            MinViewDistSq = FMath::Min(MinViewDistSq, FVector::DistSquared(ViewLocation, ProxyLocation));
+        }
+    }
+
+    if (MinViewDistSq > FMath::Square(NetworkSmoothingLODSnapDistance))
+    {
+        return EVPCSmoothingLOD::Snap;
+    }
+
+    // Hidden or distant proxies are smoothed at reduced rate
+
+    if (MinViewDistSq > FMath::Square(NetworkSmoothingLODReducedDistance) || ! CharacterOwner->WasRecentlyRendered(0.2f))
+    {
+        return EVPCSmoothingLOD::Reduced;
+    }
+
+    // Consume global full rate budget
+
+    if (VPCMovementCVars::NetSmoothingBudget > 0)
+    {
+        if (VPCMovementSmoothingBudget::Frame != GFrameCounter)
+        {
+            VPCMovementSmoothingBudget::Frame = GFrameCounter;
+            VPCMovementSmoothingBudget::Count = 0;
+        }
+
+        if (VPCMovementSmoothingBudget::Count >= VPCMovementCVars::NetSmoothingBudget)
+        {
+            return EVPCSmoothingLOD::Reduced;
+        }
+
+        ++VPCMovementSmoothingBudget::Count;
+    }
+
+    return EVPCSmoothingLOD::Full;
+}
+
 void UVPCMovementComponent::SmoothClientPosition_Interpolate(float DeltaTime)
 {
     SCOPE_CYCLE_COUNTER(STAT_VPCMovementSmoothClientPosition_Interp);
@@ -2555,22 +2843,25 @@ void UVPCMovementComponent::SmoothClientPosition_Interpolate(float DeltaTime)
 
             const float CurrentTime = MyWorld->DemoNetDriver->DemoCurrentTime;
 
+            FVPCReplaySampleBuffer& ReplaySamples(ClientData->ReplaySamples);
+
             // Remove old samples
-            while (ClientData->ReplaySamples.Num() > 0)
-            {
-                if (ClientData->ReplaySamples[0].Time > CurrentTime - 1.0f)
-                {
-                    break;
-                }
+            int32 OldSampleCount = 0;
 
-                ClientData->ReplaySamples.RemoveAt(0);
+            while (OldSampleCount < ReplaySamples.Num() && ReplaySamples[OldSampleCount].Time <= CurrentTime - 1.0f)
+            {
+                ++OldSampleCount;
             }
 
+            ReplaySamples.RemoveFirst(OldSampleCount);
+
             FReplayExternalDataArray* ExternalReplayData = MyWorld->DemoNetDriver->GetExternalDataArrayForObject(CharacterOwner);
 
             // Grab any samples available, deserialize them, then clear originals
             if (ExternalReplayData && ExternalReplayData->Num() > 0)
             {
+                const bool bFixReplayOverSampling = (VPCMovementCVars::FixReplayOverSampling > 0);
+
                 for (int i = 0; i < ExternalReplayData->Num(); i++)
                 {
                     FVPCReplaySample ReplaySample;
@@ -2579,25 +2870,22 @@ void UVPCMovementComponent::SmoothClientPosition_Interpolate(float DeltaTime)
 
                     ReplaySample.Time = (*ExternalReplayData)[i].TimeSeconds;
 
-                    ClientData->ReplaySamples.Add(ReplaySample);
-                }
-
-                if (VPCMovementCVars::FixReplayOverSampling > 0)
-                {
-                    // Remove invalid replay samples that can occur due to oversampling (sampling at higher rate than physics is being ticked)
+                    // Skip invalid replay samples that can occur due to oversampling (sampling at higher rate than physics is being ticked)
                     // We detect this by finding samples that have the same location but have a velocity that says the character should be moving
                     // If we don't do this, then characters will look like they are skipping around, which looks really bad
-                    for (int i = 1; i < ClientData->ReplaySamples.Num(); i++)
+                    if (bFixReplayOverSampling && ReplaySamples.Num() > 0)
                     {
-                        if (ClientData->ReplaySamples[i].Location.Equals(ClientData->ReplaySamples[i-1].Location, KINDA_SMALL_NUMBER))
+                        const FVPCReplaySample& LastSample = ReplaySamples.Last();
+
+                        if (ReplaySample.Location.Equals(LastSample.Location, KINDA_SMALL_NUMBER) &&
+                            LastSample.Velocity.SizeSquared() > FMath::Square(KINDA_SMALL_NUMBER) &&
+                            ReplaySample.Velocity.SizeSquared() > FMath::Square(KINDA_SMALL_NUMBER))
                         {
-                            if (ClientData->ReplaySamples[i-1].Velocity.SizeSquared() > FMath::Square(KINDA_SMALL_NUMBER) && ClientData->ReplaySamples[i].Velocity.SizeSquared() > FMath::Square(KINDA_SMALL_NUMBER))
-                            {
-                                ClientData->ReplaySamples.RemoveAt(i);
-                                i--;
-                            }
+                            continue;
                         }
                     }
+
+                    ReplaySamples.Add(ReplaySample);
                 }
 
                 ExternalReplayData->Empty();
@@ -2605,77 +2893,63 @@ void UVPCMovementComponent::SmoothClientPosition_Interpolate(float DeltaTime)
 
             bool bFoundSample = false;
 
-            for (int i=0; i < ClientData->ReplaySamples.Num()-1; i++)
+            const int32 BracketIndex = ReplaySamples.FindBracket(CurrentTime);
+
+            if (BracketIndex != INDEX_NONE)
             {
-                if (CurrentTime >= ClientData->ReplaySamples[i].Time && CurrentTime <= ClientData->ReplaySamples[i+1].Time)
-                {
-                    const float EPSILON     = SMALL_NUMBER;
-                    const float Delta       = (ClientData->ReplaySamples[i+1].Time - ClientData->ReplaySamples[i].Time);
-                    const float LerpPercent = Delta > EPSILON ? FMath::Clamp<float>((float)(CurrentTime-ClientData->ReplaySamples[i].Time) / Delta, 0.0f, 1.0f) : 1.0f;
+                const float EPSILON     = SMALL_NUMBER;
+                const float Delta       = (ReplaySamples[BracketIndex+1].Time - ReplaySamples[BracketIndex].Time);
+                const float LerpPercent = Delta > EPSILON ? FMath::Clamp<float>((float)(CurrentTime-ReplaySamples[BracketIndex].Time) / Delta, 0.0f, 1.0f) : 1.0f;
 
-                    const FVPCReplaySample& ReplaySample1 = ClientData->ReplaySamples[i];
-                    const FVPCReplaySample& ReplaySample2 = ClientData->ReplaySamples[i+1];
+                const FVPCReplaySample& ReplaySample1 = ReplaySamples[BracketIndex];
+                const FVPCReplaySample& ReplaySample2 = ReplaySamples[BracketIndex+1];
 
-                    const FVector Location = FMath::Lerp(ReplaySample1.Location, ReplaySample2.Location, LerpPercent);
-                    const FQuat Rotation = FQuat::FastLerp(FQuat(ReplaySample1.Rotation), FQuat(ReplaySample2.Rotation), LerpPercent).GetNormalized();
-                    Velocity = FMath::Lerp(ReplaySample1.Velocity, ReplaySample2.Velocity, LerpPercent);
-                    //Acceleration = FMath::Lerp(ClientData->ReplaySamples[i].Acceleration, ClientData->ReplaySamples[i+1].Acceleration, LerpPercent);
-                    Acceleration = ClientData->ReplaySamples[i+1].Acceleration;
+                const FVector Location = FMath::Lerp(ReplaySample1.Location, ReplaySample2.Location, LerpPercent);
+                const FQuat Rotation = FQuat::FastLerp(FQuat(ReplaySample1.Rotation), FQuat(ReplaySample2.Rotation), LerpPercent).GetNormalized();
+                Velocity = FMath::Lerp(ReplaySample1.Velocity, ReplaySample2.Velocity, LerpPercent);
+                //Acceleration = FMath::Lerp(ReplaySample1.Acceleration, ReplaySample2.Acceleration, LerpPercent);
+                Acceleration = ReplaySample2.Acceleration;
 
-                    UpdateComponentVelocity();
+                UpdateComponentVelocity();
 
-                    USceneComponent* Mesh = CharacterOwner->GetMeshRoot();
+                USceneComponent* Mesh = CharacterOwner->GetMeshRoot();
 
-                    if (Mesh)
-                    {
-                        Mesh->RelativeLocation = CharacterOwner->GetBaseTranslationOffset();
-                        Mesh->RelativeRotation = CharacterOwner->GetBaseRotationOffset().Rotator();
-                    }
+                if (Mesh)
+                {
+                    Mesh->RelativeLocation = CharacterOwner->GetBaseTranslationOffset();
+                    Mesh->RelativeRotation = CharacterOwner->GetBaseRotationOffset().Rotator();
+                }
 
-                    ClientData->MeshTranslationOffset = Location;
-                    ClientData->MeshRotationOffset = Rotation;
+                ClientData->MeshTranslationOffset = Location;
+                ClientData->MeshRotationOffset = Rotation;
 
 #if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
-                    if (VPCMovementCVars::NetVisualizeSimulatedCorrections >= 1)
-                    {
-                        const float Radius      = 4.0f;
-                        const int32 Sides       = 8;
-                        const float ArrowSize   = 4.0f;
-                        const FColor DebugColor = FColor::White;
+                if (VPCMovementCVars::NetVisualizeSimulatedCorrections >= 1)
+                {
+                    const float Radius      = 4.0f;
+                    const int32 Sides       = 8;
+                    const float ArrowSize   = 4.0f;
+                    const FColor DebugColor = FColor::White;
 
-                        const FVector DebugLocation = CharacterOwner->GetMeshRoot()->GetComponentLocation() + FVector(0.f, 0.f, 300.0f) - CharacterOwner->GetBaseTranslationOffset();
+                    const FVector DebugLocation = CharacterOwner->GetMeshRoot()->GetComponentLocation() + FVector(0.f, 0.f, 300.0f) - CharacterOwner->GetBaseTranslationOffset();
 
-                        FString DebugText = FString::Printf(TEXT("Lerp: %2.2f"), LerpPercent);
-                        DrawDebugString(GetWorld(), DebugLocation, DebugText, nullptr, DebugColor, 0.f, true);
-                        DrawDebugBox(GetWorld(), DebugLocation, FVector(45, 45, 45), CharacterOwner->GetMeshRoot()->GetComponentQuat(), FColor(0, 255, 0));
+                    FString DebugText = FString::Printf(TEXT("Lerp: %2.2f"), LerpPercent);
+                    DrawDebugString(GetWorld(), DebugLocation, DebugText, nullptr, DebugColor, 0.f, true);
+                    DrawDebugBox(GetWorld(), DebugLocation, FVector(45, 45, 45), CharacterOwner->GetMeshRoot()->GetComponentQuat(), FColor(0, 255, 0));
 
-                        DrawDebugDirectionalArrow(GetWorld(), DebugLocation, DebugLocation + Velocity, 20.0f, FColor(255, 0, 0, 255));
-                    }
-#endif
-                    bFoundSample = true;
-                    break;
+                    DrawDebugDirectionalArrow(GetWorld(), DebugLocation, DebugLocation + Velocity, 20.0f, FColor(255, 0, 0, 255));
                 }
+#endif
+                bFoundSample = true;
             }
 
             if (!bFoundSample)
             {
-                int32 BestSample = -1;
-                float BestTime = 0.0f;
-
-                for (int i = 0; i < ClientData->ReplaySamples.Num(); i++)
-                {
-                    const FVPCReplaySample& ReplaySample = ClientData->ReplaySamples[i];
-
-                    if (BestSample == -1 || FMath::Abs(BestTime - ReplaySample.Time) < BestTime)
-                    {
-                        BestTime = ReplaySample.Time;
-                        BestSample = i;
-                    }
-                }
+                const int32 BestSample = ReplaySamples.FindNearest(CurrentTime);
 
-                if (BestSample != -1)
+                if (BestSample != INDEX_NONE)
                 {
-                    const FVPCReplaySample& ReplaySample = ClientData->ReplaySamples[BestSample];
+                    const FVPCReplaySample& ReplaySample = ReplaySamples[BestSample];
 
                     Velocity        = ReplaySample.Velocity;
                     Acceleration    = ReplaySample.Acceleration;
@@ -2997,6 +3271,12 @@ void UVPCMovementComponent::SetAvoidanceEnabled(bool bEnable)
     if (bUseRVOAvoidance != bEnable)
     {
         bUseRVOAvoidance = bEnable;
+
+        // Release built-in solver agent, registered again on the next avoidance update
+        if (! bUseRVOAvoidance)
+        {
+            AvoidanceAgent.Unregister();
+        }
     }
 }
 
@@ -3222,6 +3502,7 @@ FNetworkPredictionData_Client_VPC::FNetworkPredictionData_Client_VPC(const UVPCM
     , SmoothNetUpdateTime(0.f)
     , SmoothNetUpdateRotationTime(0.f)
     , MaxMoveDeltaTime(0.125f)
+    , SmoothingLODAccumulatedTime(0.f)
 #if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
     , LastSmoothLocation_Debug(FVector::ZeroVector)
     , LastServerLocation_Debug(FVector::ZeroVector)
@@ -3231,6 +3512,8 @@ FNetworkPredictionData_Client_VPC::FNetworkPredictionData_Client_VPC(const UVPCM
     MaxSmoothNetUpdateDist = ClientMovement.NetworkMaxSmoothUpdateDistance;
     NoSmoothNetUpdateDist = ClientMovement.NetworkNoSmoothUpdateDistance;
 
+    ReplaySamples.SetCapacity(ClientMovement.NetworkReplaySampleCapacity);
+
     const bool bIsListenServer = (ClientMovement.GetNetMode() == NM_ListenServer);
     SmoothNetUpdateTime = (bIsListenServer ? ClientMovement.ListenServerNetworkSimulatedSmoothLocationTime : ClientMovement.NetworkSimulatedSmoothLocationTime);
     SmoothNetUpdateRotationTime = (bIsListenServer ? ClientMovement.ListenServerNetworkSimulatedSmoothRotationTime : ClientMovement.NetworkSimulatedSmoothRotationTime);
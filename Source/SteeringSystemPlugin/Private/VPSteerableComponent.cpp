@@ -28,7 +28,10 @@
 #include "VPSteerableComponent.h"
 #include "VPawn.h"
 #include "VPMovementComponent.h"
+#include "ControlInputComponent.h"
 #include "SteeringTypes.h"
+#include "VSteeringTrace.h"
+#include "VSteeringMemory.h"
 
 #include "GameFramework/MovementComponent.h"
 
@@ -67,6 +70,15 @@ void UVPSteerableComponent::OnRegister()
 			}
 		}
 	}
+
+    // Simulated proxy input goes through control input component if the owner has one
+    if (! ControlInputComponent)
+    {
+		if (AActor* MyActor = GetOwner())
+		{
+            ControlInputComponent = MyActor->FindComponentByClass<UControlInputComponent>();
+        }
+    }
 }
 
 void UVPSteerableComponent::RegisterComponentTickFunctions(bool bRegister)
@@ -100,6 +112,14 @@ void UVPSteerableComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
     Super::EndPlay(EndPlayReason);
 }
 
+void UVPSteerableComponent::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
+{
+    Super::GetResourceSizeEx(CumulativeResourceSize);
+
+    // Behavior list nodes, behavior objects and their shared reference controllers
+    CumulativeResourceSize.AddDedicatedSystemMemoryBytes(FVSteeringMemory::GetBehaviorListSize(Behaviors));
+}
+
 void UVPSteerableComponent::SetMovementComponent(UVPMovementComponent* InMovementComponent)
 {
     // Remove tick prerequisite from existing movement component
@@ -196,10 +216,17 @@ bool UVPSteerableComponent::UpdateActiveBehavior(float DeltaTime)
         if (! Behavior->IsActive())
         {
             Behavior->Activate();
+            STEERING_TRACE(BehaviorActivated, GetUniqueID(), Behavior->GetType(), 0.f);
         }
 
         FSteeringAcceleration ControlInput;
-        bIsDone = Behavior->CalculateSteering(DeltaTime, ControlInput);
+
+        {
+            SCOPE_STEERING_BEHAVIOR_STAT(Behavior);
+            bIsDone = Behavior->CalculateSteering(DeltaTime, ControlInput);
+        }
+
+        STEERING_TRACE(ControlInput, GetUniqueID(), Behavior->GetType(), ControlInput.Linear.Size());
 
         MovementComponent->AddInputVector(ControlInput.Linear);
         MovementComponent->MarkInputEnabled(ControlInput.bEnableAcceleration);
@@ -210,9 +237,11 @@ bool UVPSteerableComponent::UpdateActiveBehavior(float DeltaTime)
             if (Behavior->IsActive())
             {
                 Behavior->Deactivate();
+                STEERING_TRACE(BehaviorDeactivated, GetUniqueID(), Behavior->GetType(), 0.f);
             }
 
             bInProgress = false;
+            STEERING_TRACE(BehaviorDone, GetUniqueID(), Behavior->GetType(), 0.f);
             BehaviorDoneEvent.Broadcast(Behavior->GetType());
         }
     }
@@ -337,6 +366,11 @@ FTickFunction* UVPSteerableComponent::GetSteerableTickFunction()
     return &PrimaryComponentTick;
 }
 
+UObject* UVPSteerableComponent::GetSteerableObject()
+{
+    return this;
+}
+
 FString UVPSteerableComponent::GetSteerableName() const
 {
     return GetNameSafe(GetOwner());
@@ -495,3 +529,31 @@ float UVPSteerableComponent::K2_GetMinControlInput() const
 {
     return GetMinControlInput();
 }
+
+// ~ Simulated Proxy Functions
+
+void UVPSteerableComponent::SetSimulatedVelocity(const FVector& InVelocity)
+{
+    if (! HasValidData() || PawnOwner->Role != ROLE_SimulatedProxy)
+    {
+        return;
+    }
+
+    // Movement components recalculate velocity from control input on tick,
+    // drive simulated movement through control input instead of writing velocity directly
+    const float MaxSpeed = MovementComponent->GetMaxSpeed();
+    const FVector SimulatedInput = (MaxSpeed > KINDA_SMALL_NUMBER)
+        ? (InVelocity / MaxSpeed).GetClampedToMaxSize(1.f)
+        : FVector::ZeroVector;
+
+    if (IsValid(ControlInputComponent))
+    {
+        ControlInputComponent->SetEnableAcceleration_Direct(true);
+        ControlInputComponent->AddInputVector_Direct(SimulatedInput, true);
+    }
+    else
+    {
+        MovementComponent->MarkInputEnabled(true);
+        MovementComponent->AddInputVector(SimulatedInput, true);
+    }
+}
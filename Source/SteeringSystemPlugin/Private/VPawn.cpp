@@ -199,7 +199,7 @@ bool AVPawn::IsMoveOrientationLocked() const
 
 FVector AVPawn::GetPendingMovementInputVector() const
 {
-    return ControlInputVector;
+    return Internal_GetPendingMovementInputVector();
 }
 
 FVector AVPawn::GetLastMovementInputVector() const
@@ -215,9 +215,17 @@ void AVPawn::Internal_AddMovementInput(FVector WorldAccel, bool bForce /*=false*
     }
 }
 
+void AVPawn::AddMovementInput_Concurrent(const FVector& WorldAccel, bool bForce /*=false*/)
+{
+    if (bForce || ! IsMoveInputIgnored())
+    {
+        ConcurrentControlInput.Add(WorldAccel);
+    }
+}
+
 FVector AVPawn::Internal_ConsumeMovementInputVector()
 {
-    LastControlInputVector = ControlInputVector;
+    LastControlInputVector = ControlInputVector + ConcurrentControlInput.Consume();
     ControlInputVector = FVector::ZeroVector;
     bIsMoveInputEnabled = true;
     bIsMoveOrientationLocked = false;
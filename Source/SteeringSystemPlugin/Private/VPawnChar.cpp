@@ -109,6 +109,7 @@ AVPawnChar::AVPawnChar(const FObjectInitializer& ObjectInitializer)
     }
 
     BaseRotationOffset = FQuat::Identity;
+    bUseCompactReplicatedMovement = false;
 }
 
 void AVPawnChar::PostInitializeComponents()
@@ -463,6 +464,18 @@ void AVPawnChar::OnRep_ReplicatedBasedMovement()
     }
 }
 
+void AVPawnChar::OnRep_ReplicatedCompactMovement()
+{
+    if (Role == ROLE_SimulatedProxy)
+    {
+        // Expand compact movement and apply it as a regular movement update
+        ReplicatedCompactMovement.CopyToRepMovement(ReplicatedMovement, this);
+
+        PostNetReceiveVelocity(ReplicatedMovement.LinearVelocity);
+        PostNetReceiveLocationAndRotation();
+    }
+}
+
 void AVPawnChar::OnUpdateSimulatedPosition(const FVector& OldLocation, const FQuat& OldRotation)
 {
     CharacterMovement->bJustTeleported = true;
@@ -494,6 +507,15 @@ void AVPawnChar::PreReplication(IRepChangedPropertyTracker & ChangedPropertyTrac
     ReplicatedMovementMode = CharacterMovement->PackNetworkMovementMode();  
     ReplicatedBasedMovement = BasedMovement;
 
+    // Replace full replicated movement with its compact version
+    if (bUseCompactReplicatedMovement)
+    {
+        ReplicatedCompactMovement.SetFromRepMovement(ReplicatedMovement);
+    }
+
+    DOREPLIFETIME_ACTIVE_OVERRIDE(AVPawnChar, ReplicatedCompactMovement, bReplicateMovement && bUseCompactReplicatedMovement);
+    DOREPLIFETIME_ACTIVE_OVERRIDE(AActor, ReplicatedMovement, bReplicateMovement && ! bUseCompactReplicatedMovement);
+
     // Optimization: only update and replicate these values if they are actually going to be used.
     if (BasedMovement.HasRelativeLocation())
     {
@@ -551,6 +573,7 @@ void AVPawnChar::GetLifetimeReplicatedProps(TArray< FLifetimeProperty > & OutLif
     DOREPLIFETIME_CONDITION( AVPawnChar, ReplicatedBasedMovement,   COND_SimulatedOnly );
     DOREPLIFETIME_CONDITION( AVPawnChar, ReplicatedMovementMode,    COND_SimulatedOnly );
     DOREPLIFETIME_CONDITION( AVPawnChar, ReplicatedServerLastTransformUpdateTimeStamp, COND_SimulatedOnlyNoReplay );
+    DOREPLIFETIME_CONDITION( AVPawnChar, ReplicatedCompactMovement, COND_SimulatedOnlyNoReplay );
 
     // Change the condition of the replicated movement property to not replicate in replays since we handle this specifically
     // via saving this out in external replay data
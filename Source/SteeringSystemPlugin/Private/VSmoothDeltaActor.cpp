@@ -30,6 +30,8 @@
 #include "Components/ArrowComponent.h"
 #include "Components/BoxComponent.h"
 #include "Engine/CollisionProfile.h"
+#include "Engine/World.h"
+#include "GameFramework/GameStateBase.h"
 #include "Net/UnrealNetwork.h"
 
 FName AVSmoothDeltaActor::ShapeComponentName(TEXT("RootCollision"));
@@ -51,6 +53,9 @@ AVSmoothDeltaActor::AVSmoothDeltaActor(const FObjectInitializer& ObjectInitializ
 
     ReplicatedUpdateTimeStamp = 0.f;
     ReplicatedSimulationTime = 0.f;
+    bUseCompactReplicatedMovement = false;
+    bUseDeterministicReplication = false;
+    DeterministicCorrectionTolerance = 0.05f;
 
     bCollideWhenPlacing = true;
     SpawnCollisionHandlingMethod = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButDontSpawnIfColliding;
@@ -123,6 +128,56 @@ void AVSmoothDeltaActor::MovementSourceChange()
     }
 }
 
+float AVSmoothDeltaActor::GetServerClockTime() const
+{
+    const UWorld* World = GetWorld();
+
+    if (! World)
+    {
+        return 0.f;
+    }
+
+    const AGameStateBase* GameState = World->GetGameState();
+    return GameState ? GameState->GetServerWorldTimeSeconds() : World->GetTimeSeconds();
+}
+
+float AVSmoothDeltaActor::GetSynchronizedSimulationTime(float SimulationDuration) const
+{
+    if (SimulationDuration <= 0.f)
+    {
+        return 0.f;
+    }
+
+    const float SimulationTime = FMath::Fmod(GetServerClockTime() - ReplicatedSimulationSync.StartTime, SimulationDuration);
+    return (SimulationTime < 0.f) ? (SimulationTime + SimulationDuration) : SimulationTime;
+}
+
+void AVSmoothDeltaActor::UpdateSimulationSync(float SimulationTime, float SimulationDuration)
+{
+    if (! bUseDeterministicReplication || Role != ROLE_Authority)
+    {
+        return;
+    }
+
+    bool bRequireCorrection = ! ReplicatedSimulationSync.IsValid();
+
+    if (! bRequireCorrection && SimulationDuration > 0.f)
+    {
+        // Wrapped deviation between server and synchronized simulation time
+        const float Deviation = FMath::Abs(GetSynchronizedSimulationTime(SimulationDuration) - SimulationTime);
+        bRequireCorrection = FMath::Min(Deviation, SimulationDuration - Deviation) > DeterministicCorrectionTolerance;
+    }
+
+    if (bRequireCorrection)
+    {
+        ReplicatedSimulationSync.StartTime = GetServerClockTime() - SimulationTime;
+        ReplicatedSimulationSync.Revision = (ReplicatedSimulationSync.Revision < MAX_uint8) ? (ReplicatedSimulationSync.Revision + 1) : 1;
+
+        // Send correction as soon as possible regardless of update frequency
+        ForceNetUpdate();
+    }
+}
+
 void AVSmoothDeltaActor::GetLifetimeReplicatedProps(TArray< FLifetimeProperty > & OutLifetimeProps) const
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
@@ -130,6 +185,8 @@ void AVSmoothDeltaActor::GetLifetimeReplicatedProps(TArray< FLifetimeProperty >
     DOREPLIFETIME_CONDITION( AVSmoothDeltaActor, ReplicatedMovementSource,  COND_SimulatedOnly );
     DOREPLIFETIME_CONDITION( AVSmoothDeltaActor, ReplicatedSimulationTime,  COND_SimulatedOnly );
     DOREPLIFETIME_CONDITION( AVSmoothDeltaActor, ReplicatedUpdateTimeStamp, COND_SimulatedOnlyNoReplay );
+    DOREPLIFETIME_CONDITION( AVSmoothDeltaActor, ReplicatedCompactMovement, COND_SimulatedOnlyNoReplay );
+    DOREPLIFETIME_CONDITION( AVSmoothDeltaActor, ReplicatedSimulationSync,  COND_SimulatedOnly );
 
     // Change the condition of the replicated movement property to not replicate in replays since we handle this specifically
     // via saving this out in external replay data
@@ -152,11 +209,27 @@ void AVSmoothDeltaActor::PreReplication(IRepChangedPropertyTracker & ChangedProp
     }
 
     ReplicatedMovementSource = MovementSource;
+
+    // Replace full replicated movement with its compact version
+    if (bUseCompactReplicatedMovement)
+    {
+        ReplicatedCompactMovement.SetFromRepMovement(ReplicatedMovement);
+    }
+
+    // Deterministic replication reconstructs simulation from the synchronized server clock, only sync corrections are replicated
+    const bool bReplicateSimulation = ! bUseDeterministicReplication;
+
+    DOREPLIFETIME_ACTIVE_OVERRIDE(AVSmoothDeltaActor, ReplicatedSimulationTime, bReplicateSimulation);
+    DOREPLIFETIME_ACTIVE_OVERRIDE(AVSmoothDeltaActor, ReplicatedUpdateTimeStamp, bReplicateSimulation);
+    DOREPLIFETIME_ACTIVE_OVERRIDE(AVSmoothDeltaActor, ReplicatedSimulationSync, bUseDeterministicReplication);
+    DOREPLIFETIME_ACTIVE_OVERRIDE(AVSmoothDeltaActor, ReplicatedCompactMovement, bReplicateSimulation && bReplicateMovement && bUseCompactReplicatedMovement);
+    DOREPLIFETIME_ACTIVE_OVERRIDE(AActor, ReplicatedMovement, bReplicateSimulation && bReplicateMovement && ! bUseCompactReplicatedMovement);
 }
 
 void AVSmoothDeltaActor::PostNetReceive()
 {
-    if (Role == ROLE_SimulatedProxy)
+    // Deterministic replication corrections are handled by OnRep_ReplicatedSimulationSync()
+    if (Role == ROLE_SimulatedProxy && ! bUseDeterministicReplication)
     {
         if (SDMovement)
         {
@@ -224,6 +297,34 @@ void AVSmoothDeltaActor::OnRep_ReplicatedMovementSource()
     }
 }
 
+void AVSmoothDeltaActor::OnRep_ReplicatedCompactMovement()
+{
+    if (Role == ROLE_SimulatedProxy)
+    {
+        // Expand compact movement and apply it as a regular movement update
+        ReplicatedCompactMovement.CopyToRepMovement(ReplicatedMovement, this);
+
+        PostNetReceiveVelocity(ReplicatedMovement.LinearVelocity);
+        PostNetReceiveLocationAndRotation();
+    }
+}
+
+void AVSmoothDeltaActor::OnRep_ReplicatedSimulationSync()
+{
+    if (Role == ROLE_SimulatedProxy && SDMovement && ReplicatedSimulationSync.IsValid())
+    {
+        const FVector OldLocation = GetActorLocation();
+        const FQuat OldRotation = GetActorQuat();
+
+        SDMovement->bNetworkSmoothingComplete = false;
+        SDMovement->bNetworkUpdateReceived = true;
+
+        SDMovement->SmoothCorrection(GetSynchronizedSimulationTime(SDMovement->Duration));
+
+        OnUpdateSimulatedPosition(OldLocation, OldRotation);
+    }
+}
+
 void AVSmoothDeltaActor::OnUpdateSimulatedPosition(const FVector& OldLocation, const FQuat& OldRotation)
 {
     if (SDMovement)
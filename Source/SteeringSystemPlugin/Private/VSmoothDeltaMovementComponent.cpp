@@ -305,6 +305,12 @@ void UVSmoothDeltaMovementComponent::PerformMovement(float DeltaTime)
     LastUpdateRotation = NewRotation;
     LastUpdateVelocity = Velocity;
     ServerLastSimulationTime = CurrentSimulationTime;
+
+    // Send simulation correction if deviated from synchronized simulation time
+    if (bHasAuthority && SDOwner->IsUsingDeterministicReplication())
+    {
+        SDOwner->UpdateSimulationSync(CurrentSimulationTime, Duration);
+    }
 }
 
 void UVSmoothDeltaMovementComponent::StartMovementUpdate(float DeltaTime)
@@ -411,8 +417,12 @@ void UVSmoothDeltaMovementComponent::SimulateMovement(float DeltaTime)
 
     const bool bIsSimulatedProxy = (SDOwner->Role == ROLE_SimulatedProxy);
 
+    const bool bIsSynchronized = bIsSimulatedProxy && SDOwner->IsUsingDeterministicReplication();
+
+    const bool bHasInitialUpdate = bIsSynchronized ? SDOwner->HasSimulationSync() : (SDOwner->GetReplicatedUpdateTimeStamp() > 0.f);
+
     // Workaround for replication not being updated initially
-    if (bIsSimulatedProxy && (SDOwner->GetReplicatedUpdateTimeStamp() <= 0.f || Duration <= MIN_TICK_TIME))
+    if (bIsSimulatedProxy && (! bHasInitialUpdate || Duration <= MIN_TICK_TIME))
     {
         return;
     }
@@ -444,8 +454,15 @@ void UVSmoothDeltaMovementComponent::SimulateMovement(float DeltaTime)
         OldVelocity = Velocity;
         OldLocation = UpdatedComponent->GetComponentLocation();
 
-        // Calculate current simulation time
-        CurrentSimulationTime = GetClampedSimulationTime(CurrentSimulationTime + DeltaTime);
+        // Calculate current simulation time, deterministic replication follows the synchronized server clock
+        if (bIsSynchronized)
+        {
+            CurrentSimulationTime = SDOwner->GetSynchronizedSimulationTime(Duration);
+        }
+        else
+        {
+            CurrentSimulationTime = GetClampedSimulationTime(CurrentSimulationTime + DeltaTime);
+        }
 
         MoveSmooth(DeltaTime);
 
@@ -1288,6 +1305,12 @@ bool UVSmoothDeltaMovementComponent::HasValidData() const
 
 bool UVSmoothDeltaMovementComponent::ShouldCancelAdaptiveReplication() const
 {
+    // Movement is reconstructed by clients, nothing to replicate sooner
+    if (SDOwner && SDOwner->IsUsingDeterministicReplication())
+    {
+        return false;
+    }
+
     // Update sooner if important properties changed.
     const bool bVelocityChanged = (Velocity != LastUpdateVelocity);
     const bool bLocationChanged = (UpdatedComponent->GetComponentLocation() != LastUpdateLocation);
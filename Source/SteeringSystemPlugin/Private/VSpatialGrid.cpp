@@ -0,0 +1,129 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+// 
+
+#include "VSpatialGrid.h"
+#include "ConvexVolume.h"
+
+FVSpatialGrid::FVSpatialGrid(float InCellSize)
+    : CellSize(0.f)
+    , InvCellSize(0.f)
+{
+    SetCellSize(InCellSize);
+}
+
+bool FVSpatialGrid::SetCellSize(float InCellSize)
+{
+    InCellSize = FMath::Max(InCellSize, 1.f);
+
+    if (CellSize != InCellSize)
+    {
+        CellSize = InCellSize;
+        InvCellSize = 1.f / InCellSize;
+        Reset();
+        return true;
+    }
+
+    return false;
+}
+
+void FVSpatialGrid::Reset()
+{
+    Cells.Reset();
+    Items.Reset();
+}
+
+void FVSpatialGrid::Update(int32 Item, const FBox& Bounds)
+{
+    const FIntPoint CellId(GetCellId(Bounds));
+
+    if (FItem* Entry = Items.Find(Item))
+    {
+        const FIntPoint PrevCellId(Entry->CellId);
+        Entry->CellId = CellId;
+        Entry->Bounds = Bounds;
+
+        if (PrevCellId == CellId)
+        {
+            // Same cell, grow bounds only
+            Cells.FindChecked(CellId).Bounds += Bounds;
+            return;
+        }
+
+        RemoveFromCell(Item, PrevCellId);
+    }
+    else
+    {
+        Items.Emplace(Item, FItem{ CellId, Bounds });
+    }
+
+    FCell& Cell(Cells.FindOrAdd(CellId));
+    Cell.Bounds += Bounds;
+    Cell.Items.Emplace(Item);
+}
+
+void FVSpatialGrid::Remove(int32 Item)
+{
+    FItem Entry;
+
+    if (Items.RemoveAndCopyValue(Item, Entry))
+    {
+        RemoveFromCell(Item, Entry.CellId);
+    }
+}
+
+void FVSpatialGrid::RemoveFromCell(int32 Item, const FIntPoint& CellId)
+{
+    FCell& Cell(Cells.FindChecked(CellId));
+    Cell.Items.RemoveSingleSwap(Item, false);
+
+    // Release empty cells
+    if (Cell.Items.Num() == 0)
+    {
+        Cells.Remove(CellId);
+        return;
+    }
+
+    Cell.Bounds.Init();
+
+    for (int32 CellItem : Cell.Items)
+    {
+        Cell.Bounds += Items.FindChecked(CellItem).Bounds;
+    }
+}
+
+void FVSpatialGrid::Query(const FConvexVolume& Volume, TArray<int32>& OutItems) const
+{
+    for (const TPair<FIntPoint, FCell>& Cell : Cells)
+    {
+        const FBox& CellBounds(Cell.Value.Bounds);
+
+        if (CellBounds.IsValid && Volume.IntersectBox(CellBounds.GetCenter(), CellBounds.GetExtent()))
+        {
+            OutItems.Append(Cell.Value.Items);
+        }
+    }
+}
@@ -0,0 +1,206 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+// 
+
+#include "VSplineFollowerBatch.h"
+#include "SplineFollowingMovementComponent.h"
+#include "VBakedSplineCache.h"
+#include "Components/SplineComponent.h"
+
+DECLARE_CYCLE_STAT(TEXT("Spline Follower Batch Evaluate"), STAT_VSplineFollowerBatch_Evaluate, STATGROUP_Steering);
+
+namespace VSplineFollowerBatchCVars
+{
+    static float SplineTimeTolerance = 1.e-3f;
+    FAutoConsoleVariableRef CVarSplineTimeTolerance(
+        TEXT("p.VSplineFollowerBatchTimeTolerance"),
+        SplineTimeTolerance,
+        TEXT("Maximum difference between predicted and actual spline time for a follower to use its batch evaluated transform."),
+        ECVF_Default);
+}
+
+// ~ FVSplineFollowerGroup
+
+FVSplineFollowerGroup::FVSplineFollowerGroup(const USplineComponent* InSpline)
+    : Spline(InSpline)
+    , EvaluatedFrame(0)
+    , bHasEvaluatedTransforms(false)
+{
+}
+
+void FVSplineFollowerGroup::AddFollower(USplineFollowingMovementComponent* Follower)
+{
+    check(Follower);
+    check(Follower->BatchIndex == INDEX_NONE);
+
+    Follower->BatchIndex = Followers.Add(Follower);
+    bHasEvaluatedTransforms = false;
+}
+
+void FVSplineFollowerGroup::RemoveFollower(USplineFollowingMovementComponent* Follower)
+{
+    check(Follower);
+
+    const int32 Index = Follower->BatchIndex;
+
+    if (Followers.IsValidIndex(Index) && Followers[Index] == Follower)
+    {
+        Followers.RemoveAtSwap(Index, 1, false);
+
+        // Update batch index of the swapped follower
+        if (Followers.IsValidIndex(Index))
+        {
+            Followers[Index]->BatchIndex = Index;
+        }
+
+        bHasEvaluatedTransforms = false;
+    }
+
+    Follower->BatchIndex = INDEX_NONE;
+}
+
+void FVSplineFollowerGroup::Evaluate()
+{
+    if (EvaluatedFrame == GFrameCounter)
+    {
+        return;
+    }
+
+    SCOPE_CYCLE_COUNTER(STAT_VSplineFollowerBatch_Evaluate);
+
+    EvaluatedFrame = GFrameCounter;
+    bHasEvaluatedTransforms = false;
+
+    const USplineComponent* SplineComponent = Spline.Get();
+    const int32 Count = Followers.Num();
+
+    if (! SplineComponent || Count < 1)
+    {
+        return;
+    }
+
+    FPSBakedSpline BakedSpline = FVBakedSplineCache::GetBakedSpline(SplineComponent);
+
+    if (! BakedSpline.IsValid())
+    {
+        return;
+    }
+
+    SplineTimes.SetNumUninitialized(Count, false);
+    Locations.SetNumUninitialized(Count, false);
+    Rotations.SetNumUninitialized(Count, false);
+
+    // Gather follower spline times for this frame
+    for (int32 i=0; i<Count; ++i)
+    {
+        SplineTimes[i] = Followers[i]->GetPredictedSplineTime();
+    }
+
+    // Evaluate all target transforms in a single pass
+    BakedSpline->GetWorldTransformsAtTimes(
+        SplineComponent->GetComponentTransform(),
+        SplineTimes.GetData(),
+        Count,
+        Locations.GetData(),
+        Rotations.GetData()
+        );
+
+    bHasEvaluatedTransforms = true;
+}
+
+bool FVSplineFollowerGroup::GetTransform(const USplineFollowingMovementComponent* Follower, float SplineTime, FVector& OutLocation, FQuat& OutRotation) const
+{
+    check(Follower);
+
+    const int32 Index = Follower->BatchIndex;
+
+    // Only use evaluated transform if the follower has been evaluated with a matching spline time.
+    // Predicted and actual times are computed separately and may differ by float rounding.
+    if (bHasEvaluatedTransforms &&
+        EvaluatedFrame == GFrameCounter &&
+        SplineTimes.IsValidIndex(Index) &&
+        FMath::IsNearlyEqual(SplineTimes[Index], SplineTime, VSplineFollowerBatchCVars::SplineTimeTolerance))
+    {
+        OutLocation = Locations[Index];
+        OutRotation = Rotations[Index];
+        return true;
+    }
+
+    return false;
+}
+
+// ~ FVSplineFollowerBatch
+
+TMap<const USplineComponent*, FPSSplineFollowerGroup> FVSplineFollowerBatch::Groups;
+
+FPSSplineFollowerGroup FVSplineFollowerBatch::Register(USplineFollowingMovementComponent* Follower, const USplineComponent* Spline)
+{
+    check(IsInGameThread());
+
+    if (! Follower || ! Spline)
+    {
+        return nullptr;
+    }
+
+    FPSSplineFollowerGroup& Group(Groups.FindOrAdd(Spline));
+
+    // Create new group if not found or stale (spline pointer reused by a new object)
+    if (! Group.IsValid() || Group->GetSpline() != Spline)
+    {
+        Group = MakeShareable(new FVSplineFollowerGroup(Spline));
+    }
+
+    Group->AddFollower(Follower);
+
+    return Group;
+}
+
+void FVSplineFollowerBatch::Unregister(USplineFollowingMovementComponent* Follower, FPSSplineFollowerGroup& Group)
+{
+    check(IsInGameThread());
+
+    if (! Follower || ! Group.IsValid())
+    {
+        return;
+    }
+
+    Group->RemoveFollower(Follower);
+
+    // Release empty group
+    if (Group->Num() == 0)
+    {
+        for (auto It = Groups.CreateIterator(); It; ++It)
+        {
+            if (It.Value() == Group)
+            {
+                It.RemoveCurrent();
+                break;
+            }
+        }
+    }
+
+    Group.Reset();
+}
@@ -0,0 +1,145 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+// 
+
+
+#include "VSteeringMemory.h"
+#include "VPSteerableComponent.h"
+#include "SteeringFormationComponent.h"
+#include "VesselMovementComponent.h"
+#include "VPCMovementComponent.h"
+#include "VBakedSplineCache.h"
+#include "VSteeringTargetCache.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/UObjectIterator.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogVSteeringMemory, Log, All);
+
+namespace VSteeringMemoryCVars
+{
+    static FAutoConsoleCommand CmdDump(
+        TEXT("p.VSteeringMemory"),
+        TEXT("Log memory totals of live steering components and per-unit averages. A unit is a steerable component."),
+        FConsoleCommandDelegate::CreateStatic(&FVSteeringMemory::Dump));
+}
+
+struct FVSteeringMemoryCategory
+{
+    int32 Count = 0;
+    SIZE_T ObjectSize = 0;
+    SIZE_T AllocatedSize = 0;
+
+    FORCEINLINE SIZE_T GetTotalSize() const
+    {
+        return ObjectSize + AllocatedSize;
+    }
+};
+
+template<class ComponentType>
+static FVSteeringMemoryCategory GatherMemoryCategory()
+{
+    FVSteeringMemoryCategory Category;
+
+    for (TObjectIterator<ComponentType> It; It; ++It)
+    {
+        ComponentType* Component = *It;
+
+        // Skip class defaults and archetypes
+        if (Component->IsTemplate() || Component->IsPendingKill())
+        {
+            continue;
+        }
+
+        ++Category.Count;
+        Category.ObjectSize += Component->GetClass()->GetStructureSize();
+        Category.AllocatedSize += Component->GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+    }
+
+    return Category;
+}
+
+static void LogMemoryCategory(const TCHAR* Name, const FVSteeringMemoryCategory& Category, int32 UnitCount)
+{
+    const double Total = Category.GetTotalSize();
+
+    UE_LOG(LogVSteeringMemory, Log,
+        TEXT("%-28s %8d %12.1f KB %12.1f KB %12.1f KB %10.1f B %10.1f B"),
+        Name,
+        Category.Count,
+        Category.ObjectSize / 1024.0,
+        Category.AllocatedSize / 1024.0,
+        Total / 1024.0,
+        Category.Count > 0 ? Total / Category.Count : 0.0,
+        UnitCount > 0 ? Total / UnitCount : 0.0);
+}
+
+void FVSteeringMemory::Dump()
+{
+    const FVSteeringMemoryCategory Steerables = GatherMemoryCategory<UVPSteerableComponent>();
+    const FVSteeringMemoryCategory Formations = GatherMemoryCategory<USteeringFormationComponent>();
+    const FVSteeringMemoryCategory VesselMovements = GatherMemoryCategory<UVesselMovementComponent>();
+    const FVSteeringMemoryCategory VPCMovements = GatherMemoryCategory<UVPCMovementComponent>();
+
+    // Shared caches are not owned by any unit, report allocated size only
+    FVSteeringMemoryCategory SplineCache;
+    SplineCache.AllocatedSize = FVBakedSplineCache::GetAllocatedSize();
+
+    FVSteeringMemoryCategory TargetCache;
+    TargetCache.Count = FVSteeringTargetCache::Num();
+    TargetCache.AllocatedSize = FVSteeringTargetCache::GetAllocatedSize();
+
+    const int32 UnitCount = Steerables.Count;
+
+    FVSteeringMemoryCategory Total;
+    Total.Count = UnitCount;
+
+    const FVSteeringMemoryCategory* const Categories[] = { &Steerables, &Formations, &VesselMovements, &VPCMovements, &SplineCache, &TargetCache };
+
+    for (const FVSteeringMemoryCategory* Category : Categories)
+    {
+        Total.ObjectSize += Category->ObjectSize;
+        Total.AllocatedSize += Category->AllocatedSize;
+    }
+
+    UE_LOG(LogVSteeringMemory, Log, TEXT("Steering memory, %d units"), UnitCount);
+    UE_LOG(LogVSteeringMemory, Log,
+        TEXT("%-28s %8s %15s %15s %15s %12s %12s"),
+        TEXT("Category"),
+        TEXT("Count"),
+        TEXT("Object"),
+        TEXT("Allocated"),
+        TEXT("Total"),
+        TEXT("Per Object"),
+        TEXT("Per Unit"));
+
+    LogMemoryCategory(TEXT("SteerableComponent"), Steerables, UnitCount);
+    LogMemoryCategory(TEXT("SteeringFormationComponent"), Formations, UnitCount);
+    LogMemoryCategory(TEXT("VesselMovementComponent"), VesselMovements, UnitCount);
+    LogMemoryCategory(TEXT("VPCMovementComponent"), VPCMovements, UnitCount);
+    LogMemoryCategory(TEXT("BakedSplineCache"), SplineCache, UnitCount);
+    LogMemoryCategory(TEXT("SteeringTargetCache"), TargetCache, UnitCount);
+    LogMemoryCategory(TEXT("Total"), Total, UnitCount);
+}
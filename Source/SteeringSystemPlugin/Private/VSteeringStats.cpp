@@ -0,0 +1,56 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+// 
+
+#include "VSteeringStats.h"
+
+DEFINE_STAT(STAT_VBehaviorAllocations);
+DEFINE_STAT(STAT_VFormationPatternUpdates);
+DEFINE_STAT(STAT_VFormationSlotReassignments);
+
+#if STATS
+
+TMap<FName, FVSteeringStats::FBehaviorStats> FVSteeringStats::BehaviorStats;
+
+FVSteeringStats::FBehaviorStats FVSteeringStats::GetBehaviorStats(FName BehaviorType)
+{
+    check(IsInGameThread());
+
+    if (const FBehaviorStats* Stats = BehaviorStats.Find(BehaviorType))
+    {
+        return *Stats;
+    }
+
+    const FString TypeName(BehaviorType.IsNone() ? TEXT("UnknownBehavior") : BehaviorType.ToString());
+
+    FBehaviorStats Stats;
+    Stats.CycleStat = FDynamicStats::CreateStatId<FStatGroup_STATGROUP_Steering>(FName(*FString::Printf(TEXT("Behavior %s"), *TypeName)), true);
+    Stats.CallStat = FDynamicStats::CreateStatId<FStatGroup_STATGROUP_Steering>(FName(*FString::Printf(TEXT("Behavior %s Calls"), *TypeName)), false);
+
+    return BehaviorStats.Add(BehaviorType, Stats);
+}
+
+#endif
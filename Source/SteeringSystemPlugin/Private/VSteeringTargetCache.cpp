@@ -0,0 +1,86 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+// 
+
+
+#include "VSteeringTargetCache.h"
+#include "Components/SceneComponent.h"
+
+TMap<TWeakObjectPtr<USceneComponent>, FVSteeringTargetCache::FEntry> FVSteeringTargetCache::Entries;
+uint64 FVSteeringTargetCache::ResolvedFrame = 0;
+
+void FVSteeringTargetCache::Track(USceneComponent* Component)
+{
+    check(IsInGameThread());
+
+    if (IsValid(Component))
+    {
+        FEntry& Entry(Entries.FindOrAdd(Component));
+        Entry.Location = Component->GetComponentLocation();
+        Entry.Rotation = Component->GetComponentQuat();
+    }
+}
+
+void FVSteeringTargetCache::Resolve()
+{
+    check(IsInGameThread());
+
+    // Resolve once per frame, each ticking world requests it
+    if (ResolvedFrame == GFrameCounter)
+    {
+        return;
+    }
+
+    ResolvedFrame = GFrameCounter;
+
+    for (TMap<TWeakObjectPtr<USceneComponent>, FEntry>::TIterator It(Entries); It; ++It)
+    {
+        if (USceneComponent* Component = It.Key().Get())
+        {
+            It.Value().Location = Component->GetComponentLocation();
+            It.Value().Rotation = Component->GetComponentQuat();
+        }
+        else
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
+
+int32 FVSteeringTargetCache::Num()
+{
+    return Entries.Num();
+}
+
+SIZE_T FVSteeringTargetCache::GetAllocatedSize()
+{
+    return Entries.GetAllocatedSize();
+}
+
+void FVSteeringTargetCache::Clear()
+{
+    Entries.Empty();
+}
@@ -0,0 +1,167 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+// 
+
+#include "VSteeringTrace.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/DateTime.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogVSteeringTrace, Log, All);
+
+namespace VSteeringTraceCVars
+{
+    static int32 Enabled = 0;
+    FAutoConsoleVariableRef CVarEnabled(
+        TEXT("p.VSteeringTrace"),
+        Enabled,
+        TEXT("Whether steering decisions and formation lifecycle events are recorded.\n")
+        TEXT("0: Disable, 1: Enable"),
+        ECVF_Default);
+
+    static int32 Capacity = 65536;
+    FAutoConsoleVariableRef CVarCapacity(
+        TEXT("p.VSteeringTrace.Capacity"),
+        Capacity,
+        TEXT("Maximum number of recorded steering trace events, oldest events are overwritten first."),
+        ECVF_Default);
+
+    static FAutoConsoleCommand CmdDump(
+        TEXT("p.VSteeringTrace.Dump"),
+        TEXT("Write recorded steering trace events as CSV to the profiling directory. Optional argument: file name."),
+        FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+        {
+            const FString Filename = FPaths::ProfilingDir() / (Args.Num() > 0
+                ? Args[0]
+                : FString::Printf(TEXT("SteeringTrace-%s.csv"), *FDateTime::Now().ToString()));
+
+            if (FVSteeringTrace::Dump(Filename))
+            {
+                UE_LOG(LogVSteeringTrace, Log, TEXT("Steering trace written to %s"), *Filename);
+            }
+            else
+            {
+                UE_LOG(LogVSteeringTrace, Warning, TEXT("Failed to write steering trace to %s"), *Filename);
+            }
+        }));
+
+    static FAutoConsoleCommand CmdReset(
+        TEXT("p.VSteeringTrace.Reset"),
+        TEXT("Clear recorded steering trace events."),
+        FConsoleCommandDelegate::CreateStatic(&FVSteeringTrace::Reset));
+}
+
+TArray<FVSteeringTraceEvent> FVSteeringTrace::Events;
+int32 FVSteeringTrace::Capacity = 0;
+int32 FVSteeringTrace::Head = 0;
+
+bool FVSteeringTrace::IsEnabled()
+{
+    return VSteeringTraceCVars::Enabled != 0;
+}
+
+void FVSteeringTrace::Record(EVSteeringTraceEvent Type, uint32 Source, FName Name, float Value)
+{
+    check(IsInGameThread());
+
+    const int32 NewCapacity = FMath::Max(VSteeringTraceCVars::Capacity, 1);
+
+    // Capacity changed, restart recording
+    if (Capacity != NewCapacity)
+    {
+        Capacity = NewCapacity;
+        Events.Empty(Capacity);
+        Head = 0;
+    }
+
+    FVSteeringTraceEvent Event;
+    Event.Frame = static_cast<uint32>(GFrameCounter);
+    Event.Source = Source;
+    Event.Name = Name;
+    Event.Value = Value;
+    Event.Type = Type;
+
+    if (Events.Num() < Capacity)
+    {
+        Events.Emplace(Event);
+    }
+    else
+    {
+        Events[Head] = Event;
+    }
+
+    Head = (Head + 1) % Capacity;
+}
+
+bool FVSteeringTrace::Dump(const FString& Filename)
+{
+    check(IsInGameThread());
+
+    FString Output(TEXT("Frame,Event,Source,Name,Value\n"));
+
+    const int32 Count = Events.Num();
+    const int32 First = (Count < Capacity) ? 0 : Head;
+
+    for (int32 i=0; i<Count; ++i)
+    {
+        const FVSteeringTraceEvent& Event(Events[(First + i) % Count]);
+
+        Output += FString::Printf(
+            TEXT("%u,%s,%u,%s,%f\n"),
+            Event.Frame,
+            GetEventName(Event.Type),
+            Event.Source,
+            *Event.Name.ToString(),
+            Event.Value
+            );
+    }
+
+    return FFileHelper::SaveStringToFile(Output, *Filename);
+}
+
+void FVSteeringTrace::Reset()
+{
+    Events.Reset();
+    Head = 0;
+}
+
+const TCHAR* FVSteeringTrace::GetEventName(EVSteeringTraceEvent Type)
+{
+    switch (Type)
+    {
+        case EVSteeringTraceEvent::BehaviorActivated:         return TEXT("BehaviorActivated");
+        case EVSteeringTraceEvent::BehaviorDeactivated:       return TEXT("BehaviorDeactivated");
+        case EVSteeringTraceEvent::BehaviorDone:              return TEXT("BehaviorDone");
+        case EVSteeringTraceEvent::ControlInput:              return TEXT("ControlInput");
+        case EVSteeringTraceEvent::FormationMemberAdded:      return TEXT("FormationMemberAdded");
+        case EVSteeringTraceEvent::FormationMemberRemoved:    return TEXT("FormationMemberRemoved");
+        case EVSteeringTraceEvent::FormationPatternRebuild:   return TEXT("FormationPatternRebuild");
+        case EVSteeringTraceEvent::FormationSlotReassignment: return TEXT("FormationSlotReassignment");
+    }
+
+    return TEXT("Unknown");
+}
@@ -29,6 +29,7 @@
 #include "ControlInputComponent.h"
 #include "RVO3DAgentComponent.h"
 #include "GameFramework/Controller.h"
+#include "Curves/CurveFloat.h"
 
 UVesselMovementComponent::UVesselMovementComponent(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
@@ -40,18 +41,34 @@ UVesselMovementComponent::UVesselMovementComponent(const FObjectInitializer& Obj
     Acceleration = 4000.f;
     Deceleration = 8000.f;
 
+    // Vessel dynamics
+    bUseVesselDynamics = false;
+    ForwardDrag = .2f;
+    LateralDrag = 2.f;
+    TurnSpeedLoss = .25f;
+    ThrustCurve = nullptr;
+    DragCurve = nullptr;
+    DynamicsCurveSampleCount = 32;
+
     // Orientation
-    bUseTurnRange = false;
     TurnRate = 45.f;
     MinTurnRate = -1.f;
     TurnAcceleration = 45.f;
-    CurrentTurnRate = 0.f;
 
     bPositionCorrected = false;
     bAutoRegisterControlComponent = true;
     bAutoRegisterRVOAgentComponent = true;
 
     bUseRVOAvoidance = true;
+    bUseBuiltInAvoidance = false;
+
+    // Fixed time step
+    bUseFixedTimeStep = false;
+    FixedTimeStep = 1.f / 30.f;
+    MaxFixedTimeSteps = 4;
+    InterpolatedComponent = nullptr;
+    InterpolatedBaseLocation = FVector::ZeroVector;
+    InterpolatedBaseRotation = FQuat::Identity;
 }
 
 void UVesselMovementComponent::InitializeComponent()
@@ -72,7 +89,8 @@ void UVesselMovementComponent::InitializeComponent()
         }
     }
 
-    if (! RVOAgentComponent && bAutoRegisterRVOAgentComponent)
+    // Built-in avoidance does not use the RVO agent component
+    if (! RVOAgentComponent && bAutoRegisterRVOAgentComponent && ! bUseBuiltInAvoidance)
     {
         // Auto-register owner's root component if found.
         if (AActor* MyActor = GetOwner())
@@ -87,6 +105,18 @@ void UVesselMovementComponent::InitializeComponent()
     }
 
     RefreshTurnRange();
+    RefreshVesselDynamics();
+}
+
+void UVesselMovementComponent::SetUpdatedComponent(USceneComponent* NewUpdatedComponent)
+{
+    Super::SetUpdatedComponent(NewUpdatedComponent);
+
+    // Fixed time step visuals start at the new updated component transform
+    if (UpdatedComponent)
+    {
+        FixedTimeStepState.ResetStepState(*UpdatedComponent);
+    }
 }
 
 void UVesselMovementComponent::OnRegister()
@@ -107,7 +137,8 @@ void UVesselMovementComponent::OnRegister()
         }
     }
 
-    if (! RVOAgentComponent && bAutoRegisterRVOAgentComponent)
+    // Built-in avoidance does not use the RVO agent component
+    if (! RVOAgentComponent && bAutoRegisterRVOAgentComponent && ! bUseBuiltInAvoidance)
     {
         // Auto-register owner's root component if found.
         if (AActor* MyActor = GetOwner())
@@ -122,7 +153,41 @@ void UVesselMovementComponent::OnRegister()
     }
 
     RefreshTurnRange();
+    RefreshVesselDynamics();
+}
+
+void UVesselMovementComponent::OnUnregister()
+{
+    AvoidanceAgent.Unregister();
+
+    Super::OnUnregister();
+}
+
+void UVesselMovementComponent::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
+{
+    Super::GetResourceSizeEx(CumulativeResourceSize);
+
+    // Baked curve lookup tables
+    CumulativeResourceSize.AddDedicatedSystemMemoryBytes(ThrustLUT.GetAllocatedSize());
+    CumulativeResourceSize.AddDedicatedSystemMemoryBytes(DragLUT.GetAllocatedSize());
+}
+
+#if WITH_EDITOR
+void UVesselMovementComponent::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+    Super::PostEditChangeProperty(PropertyChangedEvent);
+
+    const FName PropertyName = PropertyChangedEvent.Property ? PropertyChangedEvent.Property->GetFName() : NAME_None;
+
+    // Re-bake lookup tables when their source curves or resolution change
+    if (PropertyName == GET_MEMBER_NAME_CHECKED(UVesselMovementComponent, ThrustCurve) ||
+        PropertyName == GET_MEMBER_NAME_CHECKED(UVesselMovementComponent, DragCurve) ||
+        PropertyName == GET_MEMBER_NAME_CHECKED(UVesselMovementComponent, DynamicsCurveSampleCount))
+    {
+        RefreshVesselDynamics();
+    }
 }
+#endif // WITH_EDITOR
 
 void UVesselMovementComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction)
 {
@@ -138,6 +203,24 @@ void UVesselMovementComponent::TickComponent(float DeltaTime, enum ELevelTick Ti
         SetControlInputComponent(nullptr);
     }
 
+    if (bUseFixedTimeStep)
+    {
+        PerformFixedTimeStepMovement(DeltaTime);
+    }
+    else
+    {
+        PerformMovement(DeltaTime);
+    }
+
+    // Consume input once per frame, fixed steps share the same input
+    if (ControlInputComponent && ! ControlInputComponent->IsMoveInputIgnored_Direct())
+    {
+        ControlInputComponent->ConsumeInputVector_Direct();
+    }
+}
+
+void UVesselMovementComponent::PerformMovement(float DeltaTime)
+{
     //const AController* Controller = PawnOwner->GetController();
     //if (Controller && Controller->IsLocalController())
     {
@@ -185,6 +268,35 @@ void UVesselMovementComponent::TickComponent(float DeltaTime, enum ELevelTick Ti
     }
 }
 
+void UVesselMovementComponent::PerformFixedTimeStepMovement(float DeltaTime)
+{
+    // Snap visuals on the first update and after the updated component was moved outside of fixed steps
+    if (UpdatedComponent && FixedTimeStepState.RequiresReset(*UpdatedComponent))
+    {
+        FixedTimeStepState.ResetStepState(*UpdatedComponent);
+    }
+
+    const float StepTime = FMath::Max(FixedTimeStep, 0.001f);
+    const int32 StepCount = FixedTimeStepState.Advance(DeltaTime, StepTime, MaxFixedTimeSteps);
+
+    for (int32 i=0; i<StepCount && UpdatedComponent; ++i)
+    {
+        FixedTimeStepState.SaveStepState(*UpdatedComponent);
+        PerformMovement(StepTime);
+    }
+
+    if (UpdatedComponent)
+    {
+        FixedTimeStepState.FinishSteps(*UpdatedComponent);
+    }
+
+    // Interpolate visual component between the last two steps
+    if (UpdatedComponent && IsValid(InterpolatedComponent) && ! IsNetMode(NM_DedicatedServer))
+    {
+        FixedTimeStepState.UpdateVisualComponent(*InterpolatedComponent, *UpdatedComponent, InterpolatedBaseLocation, InterpolatedBaseRotation);
+    }
+}
+
 void UVesselMovementComponent::ApplyControlInputToVelocity(float DeltaTime)
 {
     if (! ControlInputComponent || ControlInputComponent->IsMoveInputIgnored_Direct())
@@ -209,52 +321,25 @@ void UVesselMovementComponent::ApplyControlInputToVelocity(float DeltaTime)
     const float CompMaxSpeed = GetMaxSpeed();
     const float InputMaxSpeed = CompMaxSpeed * AnalogInputModifier;
 
+    if (bUseVesselDynamics)
+    {
+        ApplyVesselDynamics(DeltaTime, ControlInput, bEnableAcceleration);
+        return;
+    }
+
     if (AnalogInputModifier > 0.f)
     {
         VelocityOrientation = UpdatedComponent->GetComponentQuat();
 
         // Orient velocity towards control input
-        {
-            const FVector ForwardNormal = VelocityOrientation.GetForwardVector();
-            const FVector InputNormal = ControlInput.GetUnsafeNormal();
-
-            // Interpolate velocity direction
-            if (! FVector::Coincident(ForwardNormal, InputNormal))
-            {
-                PrepareTurnRange(DeltaTime, ForwardNormal, InputNormal);
-                InterpOrientation(VelocityOrientation, ForwardNormal, InputNormal, DeltaTime, CurrentTurnRate);
-            }
-            // Set direction directly if above dot threshold
-            else
-            {
-                ClearTurnRange();
-                InterpOrientation(VelocityOrientation, ForwardNormal, InputNormal, DeltaTime, CurrentTurnRate);
-            }
-        }
+        MovementKernel.Orient(VelocityOrientation, ControlInput.GetUnsafeNormal(), DeltaTime);
 
         const FVector VelocityDirection(VelocityOrientation.GetForwardVector());
 
         // Accelerate if acceleration is enabled
         if (bEnableAcceleration)
         {
-            const float CurrentSpeed = FMath::Min(Velocity.Size(), CompMaxSpeed);
-            const float CurrentMaxSpeed = (InputMaxSpeed < CompMaxSpeed) ? InputMaxSpeed : CompMaxSpeed;
-
-            const float DecelerationDelta = FMath::Abs(Deceleration) * DeltaTime;
-            const float DecelerationThreshold = CurrentMaxSpeed + DecelerationDelta;
-
-            // Current speed has yet reached max speed, accelerate
-            if (CurrentSpeed < DecelerationThreshold)
-            {
-                const float AccelerationSpeed = CurrentSpeed + FMath::Abs(Acceleration)*DeltaTime;
-                Velocity = VelocityDirection * FMath::Min(AccelerationSpeed, CurrentMaxSpeed);
-            }
-            // Current speed has reached over max speed, decelerate to match
-            else
-            {
-                const float DecelerationSpeed = FMath::Max(Velocity.Size() - DecelerationDelta, 0.f);
-                Velocity = VelocityDirection * FMath::Max(DecelerationSpeed, CurrentMaxSpeed);
-            }
+            MovementKernel.Accelerate(Velocity, VelocityDirection, InputMaxSpeed, CompMaxSpeed, Acceleration, Deceleration, DeltaTime);
         }
         // Otherwise, decelerate
         else
@@ -268,26 +353,81 @@ void UVesselMovementComponent::ApplyControlInputToVelocity(float DeltaTime)
         Decelerate(DeltaTime);
     }
 
-    ControlInputComponent->ConsumeInputVector_Direct();
 }
 
 void UVesselMovementComponent::Decelerate(float DeltaTime)
 {
-    const float DecelerationDelta = FMath::Abs(Deceleration) * DeltaTime;
+    MovementKernel.Decelerate(Velocity, Deceleration, DeltaTime);
+}
 
-    // Dampen velocity magnitude based on deceleration.
-    if (Velocity.SizeSquared() > DecelerationDelta)
+void UVesselMovementComponent::ApplyVesselDynamics(float DeltaTime, const FVector& ControlInput, bool bEnableAcceleration)
+{
+    const float CompMaxSpeed = GetMaxSpeed();
+    const float AnalogInputModifier = (ControlInput.SizeSquared() > 0.f ? ControlInput.Size() : 0.f);
+    const FVector OldForward = UpdatedComponent->GetForwardVector();
+
+    VelocityOrientation = UpdatedComponent->GetComponentQuat();
+
+    // Orient vessel towards control input
+    if (AnalogInputModifier > 0.f)
     {
-        const float DecelerationSpeed = FMath::Max(Velocity.Size() - DecelerationDelta, 0.f);
-        Velocity = Velocity.GetSafeNormal() * DecelerationSpeed;
+        MovementKernel.Orient(VelocityOrientation, ControlInput / AnalogInputModifier, DeltaTime);
     }
+
+    const FVector Forward(VelocityOrientation.GetForwardVector());
+
+    // Split velocity into forward speed and lateral drift relative to the new orientation
+    float ForwardSpeed = Velocity | Forward;
+    FVector LateralVelocity = Velocity - Forward * ForwardSpeed;
+
+    const float SpeedRatio = (CompMaxSpeed > 0.f) ? FMath::Min(FMath::Abs(ForwardSpeed) / CompMaxSpeed, 1.f) : 0.f;
+
+    // Turn induced speed loss, turned angle approximated by sine of the angle
+    const float TurnAngle = (OldForward ^ Forward).Size();
+    ForwardSpeed *= FMath::Max(1.f - TurnSpeedLoss * TurnAngle, 0.f);
+
+    if (AnalogInputModifier > 0.f)
+    {
+        const float InputMaxSpeed = CompMaxSpeed * AnalogInputModifier;
+        const float DecelerationDelta = FMath::Abs(Deceleration) * DeltaTime;
+
+        // Thrust towards input max speed, decelerate to match if over it
+        if (bEnableAcceleration && ForwardSpeed < InputMaxSpeed)
+        {
+            const float Thrust = FMath::Abs(Acceleration) * ThrustLUT.Evaluate(SpeedRatio);
+            ForwardSpeed = FMath::Min(ForwardSpeed + Thrust*DeltaTime, InputMaxSpeed);
+        }
+        else if (bEnableAcceleration)
+        {
+            ForwardSpeed = FMath::Max(ForwardSpeed - DecelerationDelta, InputMaxSpeed);
+        }
+        // Acceleration disabled, brake
+        else
+        {
+            ForwardSpeed = FMath::Sign(ForwardSpeed) * FMath::Max(FMath::Abs(ForwardSpeed) - DecelerationDelta, 0.f);
+        }
+    }
+
+    // Implicit drag integration, stable for large delta time
+    ForwardSpeed /= 1.f + FMath::Max(ForwardDrag * DragLUT.Evaluate(SpeedRatio), 0.f) * DeltaTime;
+    LateralVelocity /= 1.f + FMath::Max(LateralDrag, 0.f) * DeltaTime;
+
+    Velocity = Forward * ForwardSpeed + LateralVelocity;
+
     // Velocity too low, set to zero
-    else
+    if (Velocity.SizeSquared() < KINDA_SMALL_NUMBER)
     {
         Velocity = FVector::ZeroVector;
     }
 }
 
+void UVesselMovementComponent::RefreshVesselDynamics()
+{
+    // Both curves are sampled over forward speed ratio
+    ThrustLUT.Bake(ThrustCurve, 0.f, 1.f, DynamicsCurveSampleCount, 1.f);
+    DragLUT.Bake(DragCurve, 0.f, 1.f, DynamicsCurveSampleCount, 1.f);
+}
+
 bool UVesselMovementComponent::ResolvePenetrationImpl(const FVector& Adjustment, const FHitResult& Hit, const FQuat& NewRotationQuat)
 {
     bPositionCorrected |= Super::ResolvePenetrationImpl(Adjustment, Hit, NewRotationQuat);
@@ -296,117 +436,67 @@ bool UVesselMovementComponent::ResolvePenetrationImpl(const FVector& Adjustment,
 
 void UVesselMovementComponent::CalcAvoidanceVelocity()
 {
-    if (! bUseRVOAvoidance || ! RVOAgentComponent)
+    if (! bUseRVOAvoidance)
     {
         return;
     }
 
-    //if (MyOwner->Role != ROLE_Authority)
-    //{
-    //    return;
-    //}
-
-    // Perform RVO calculation if currently moving
-    if (Velocity.SizeSquared() > KINDA_SMALL_NUMBER)
+    // Push agent state to the built-in solver, avoidance is solved in batch on the first query of the frame
+    if (bUseBuiltInAvoidance)
     {
-        // Calculate RVO if not already performing locked avoidance
-        if (! RVOAgentComponent->HasLockedPreferredVelocity())
+        check(ControlInputComponent);
+
+        if (! AvoidanceAgent.IsRegistered())
         {
-            if (RVOAgentComponent->HasAvoidanceVelocity())
-            {
-                // Had to divert course, lock this avoidance move in for a short time. This will make us a VO, so unlocked others will know to avoid us.
-                RVOAgentComponent->LockPreferredVelocity(Velocity);
-            }
+            AvoidanceAgent.Register(GetWorld());
         }
-    }
-}
-
-void UVesselMovementComponent::RefreshTurnRange()
-{
-    bUseTurnRange = (MinTurnRate > 0.f) && (MinTurnRate < TurnRate) && (TurnAcceleration > 0.f);
 
-    if (bUseTurnRange)
-    {
-        TurnInterpRangeInv = 1.f / (TurnRate-MinTurnRate);
-        ClearTurnRange();
-    }
-    else
-    {
-        CurrentTurnRate = TurnRate;
+        const float CompMaxSpeed = GetMaxSpeed();
+        const FVector PreferredVelocity( ControlInputComponent->GetPendingInputVector_Direct().GetClampedToMaxSize(1.f) * CompMaxSpeed );
+        AvoidanceAgent.SetState(UpdatedComponent->GetComponentLocation(), Velocity, PreferredVelocity, CompMaxSpeed, BuiltInAvoidanceSettings);
+        return;
     }
-}
 
-void UVesselMovementComponent::PrepareTurnRange(float DeltaTime, const FVector& VelocityNormal, const FVector& InputNormal)
-{
-    // turn range is not enabled, directly set current turn rate and return
-    if (! bUseTurnRange)
+    if (! RVOAgentComponent)
     {
-        if (CurrentTurnRate < TurnRate)
-        {
-            CurrentTurnRate = TurnRate;
-        }
         return;
     }
 
-    if (LastTurnDelta.SizeSquared() > 0.f)
+    //if (MyOwner->Role != ROLE_Authority)
+    //{
+    //    return;
+    //}
+
+    // Perform RVO calculation if currently moving and not already performing locked avoidance
+    if (Velocity.SizeSquared() > KINDA_SMALL_NUMBER && ! RVOAgentComponent->HasLockedPreferredVelocity())
     {
-        FVector TurnDelta = InputNormal - VelocityNormal;
+        const UWorld* World = GetWorld();
+        const float WorldTime = World ? World->GetTimeSeconds() : 0.f;
 
-        // Turning towards the same direction since last update, accelerate turn rate
-        if ((LastTurnDelta|TurnDelta) > 0.f)
+        // Reuse last avoidance state until the next scheduled solve.
+        // The agent component keeps ticking at its own rate, neighbors always see its current state.
+        if (! AvoidanceSchedule.ShouldUpdate(WorldTime))
         {
-            // Update turn rate if not yet reached maximum turn rate
-            if (CurrentTurnRate < TurnRate)
-            {
-                const float TurnInterpAlpha = ((CurrentTurnRate-MinTurnRate) + TurnAcceleration*DeltaTime) * TurnInterpRangeInv;
-                const float TurnInterpSpeed = FMath::Lerp(MinTurnRate, TurnRate, FMath::Clamp(TurnInterpAlpha, 0.f, 1.f));
-                CurrentTurnRate = FMath::Min(TurnInterpSpeed, TurnRate);
-            }
+            return;
         }
-        // Turning towards the opposite direction from last update, reset turn rate
-        else
+
+        if (RVOAgentComponent->HasAvoidanceVelocity())
         {
-            ClearTurnRange();
+            // Had to divert course, lock this avoidance move in for a short time. This will make us a VO, so unlocked others will know to avoid us.
+            RVOAgentComponent->LockPreferredVelocity(Velocity);
         }
 
-        LastTurnDelta = TurnDelta;
-    }
-    else
-    {
-        ClearTurnRange();
-        LastTurnDelta = (InputNormal-VelocityNormal).GetSafeNormal();
-    }
-}
-
-void UVesselMovementComponent::ClearTurnRange()
-{
-    if (bUseTurnRange && CurrentTurnRate > MinTurnRate)
-    {
-        CurrentTurnRate = MinTurnRate;
-        LastTurnDelta = FVector::ZeroVector;
+        // Deviation is measured against the control input, velocity already follows previous avoidance
+        check(ControlInputComponent);
+        const float CompMaxSpeed = GetMaxSpeed();
+        const FVector PreferredVelocity( ControlInputComponent->GetPendingInputVector_Direct().GetClampedToMaxSize(1.f) * CompMaxSpeed );
+        AvoidanceSchedule.Schedule(WorldTime, PreferredVelocity, RVOAgentComponent->GetAvoidanceVelocity(), CompMaxSpeed);
     }
 }
 
-void UVesselMovementComponent::InterpOrientation(FQuat& Orientation, const FVector& Current, const FVector& Target, float DeltaTime, float RotationSpeedDegrees)
+void UVesselMovementComponent::RefreshTurnRange()
 {
-    // Find delta rotation between both normals.
-    FQuat DeltaQuat = FQuat::FindBetweenNormals(Current, Target);
-
-    // Decompose into an axis and angle for rotation
-    FVector DeltaAxis(0.f);
-    float DeltaAngle = 0.f;
-    DeltaQuat.ToAxisAndAngle(DeltaAxis, DeltaAngle);
-
-    // Find rotation step for this frame
-    const float RotationStepRadians = RotationSpeedDegrees * (PI / 180) * DeltaTime;
-
-    if (FMath::Abs(DeltaAngle) > RotationStepRadians)
-    {
-        DeltaAngle = FMath::Clamp(DeltaAngle, -RotationStepRadians, RotationStepRadians);
-        DeltaQuat = FQuat(DeltaAxis, DeltaAngle);
-    }
-
-    Orientation = DeltaQuat * Orientation;
+    MovementKernel.RefreshTurnRange(TurnRate, MinTurnRate, TurnAcceleration);
 }
 
 float UVesselMovementComponent::GetTurnRate() const
@@ -457,16 +547,57 @@ void UVesselMovementComponent::SetRVOAgentComponent(URVO3DAgentComponent* InRVOA
 {
     // Don't assign pending kill components, but allow those to null out previous value
     RVOAgentComponent = IsValid(InRVOAgentComponent) ? InRVOAgentComponent : nullptr;
+    AvoidanceSchedule.Reset();
+}
+
+void UVesselMovementComponent::SetInterpolatedComponent(USceneComponent* InInterpolatedComponent)
+{
+    // Restore base transform of previous interpolated component
+    if (IsValid(InterpolatedComponent))
+    {
+        InterpolatedComponent->SetRelativeLocationAndRotation(InterpolatedBaseLocation, InterpolatedBaseRotation);
+    }
+
+    // Don't assign pending kill components, but allow those to null out previous value
+    InterpolatedComponent = IsValid(InInterpolatedComponent) ? InInterpolatedComponent : nullptr;
+
+    if (InterpolatedComponent)
+    {
+        InterpolatedBaseLocation = InterpolatedComponent->RelativeLocation;
+        InterpolatedBaseRotation = InterpolatedComponent->RelativeRotation.Quaternion();
+    }
+
+    if (UpdatedComponent)
+    {
+        FixedTimeStepState.ResetStepState(*UpdatedComponent);
+    }
+}
+
+bool UVesselMovementComponent::GetAvoidanceVelocity(FVector& OutVelocity) const
+{
+    if (bUseBuiltInAvoidance)
+    {
+        return AvoidanceAgent.GetAvoidanceVelocity(OutVelocity);
+    }
+
+    if (RVOAgentComponent && RVOAgentComponent->HasLockedPreferredVelocity())
+    {
+        OutVelocity = RVOAgentComponent->GetAvoidanceVelocity();
+        return true;
+    }
+
+    return false;
 }
 
 FVector UVesselMovementComponent::GetControlInput() const
 {
     check(ControlInputComponent);
 
+    FVector AvoidanceVelocity;
+
     // Override input with RVO if required
-    if (bUseRVOAvoidance && RVOAgentComponent && RVOAgentComponent->HasLockedPreferredVelocity())
+    if (bUseRVOAvoidance && GetAvoidanceVelocity(AvoidanceVelocity))
     {
-        const FVector AvoidanceVelocity( RVOAgentComponent->GetAvoidanceVelocity() );
         const float CompMaxSpeed = GetMaxSpeed();
         const float AvoidanceMagnitude = CompMaxSpeed>0.f ? (AvoidanceVelocity.Size() / CompMaxSpeed) : 0.f;
         return AvoidanceVelocity.GetSafeNormal() * AvoidanceMagnitude;
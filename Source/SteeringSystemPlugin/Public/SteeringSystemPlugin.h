@@ -36,6 +36,11 @@ public:
     /** IModuleInterface implementation */
     virtual void StartupModule() override;
     virtual void ShutdownModule() override;
+
+private:
+
+    FDelegateHandle WorldCleanupHandle;
+    FDelegateHandle WorldPreActorTickHandle;
 };
 
 DECLARE_STATS_GROUP(TEXT("Steering"), STATGROUP_Steering, STATCAT_Advanced);